@@ -0,0 +1,160 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// generated inputs & options shared by benchmark programs
+
+#ifndef B2H_BENCH_UTIL_H_
+#define B2H_BENCH_UTIL_H_
+
+#include <algorithm> // copy,fill,min
+#include <cstdlib> // strtoull
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef __WIN32__
+#include <direct.h> // _mkdir
+#else
+#include <sys/stat.h> // mkdir
+#endif
+
+
+/** Fixed seed pseudo random numbers, so inputs are equal on every system. */
+class Random {
+public:
+	Random(const unsigned long long seed) : state(seed) {}
+
+	unsigned long long next() {
+		// xorshift64*
+		state ^= state >> 12;
+		state ^= state << 25;
+		state ^= state >> 27;
+		return state * 2685821657736338717ULL;
+	}
+
+private:
+	unsigned long long state;
+};
+
+
+/** Fills a block of generated input.
+ *
+ *  @tparam string kind
+ *      "random", "zero", "text" or "png".
+ *  @tparam Random rand
+ *      Number generator continued across blocks.
+ *  @tparam char* block
+ *      Buffer to fill.
+ *  @tparam size_t size
+ *      Number of bytes to fill.
+ */
+inline void fillBlock(const std::string kind, Random& rand, char* block, const size_t size) {
+	if (kind == "zero") {
+		std::fill(block, block + size, '\0');
+	} else if (kind == "text") {
+		static const char* words[] = {"the", "data", "of", "an", "embedded", "file", "is", "written",
+				"as", "a", "header", "for", "compilers", "to", "include", "in", "programs"};
+		size_t pos = 0;
+		while (pos < size) {
+			const unsigned long long num = rand.next();
+			const std::string word = std::string(words[num % 17]) + ((num >> 32) % 12 == 0 ? "\n" : " ");
+			for (size_t idx = 0; idx < word.length() && pos < size; idx++) {
+				block[pos++] = word[idx];
+			}
+		}
+	} else {
+		// compressed image data is close to random
+		for (size_t pos = 0; pos < size; pos += 8) {
+			unsigned long long num = rand.next();
+			for (size_t idx = pos; idx < pos + 8 && idx < size; idx++) {
+				block[idx] = (char) (num & 0xff);
+				num >>= 8;
+			}
+		}
+	}
+}
+
+
+/** Writes a generated input file unless it already exists with the same size.
+ *
+ *  PNG-like files have a PNG signature & header followed by chunks of 32 KB
+ *  random data with chunk headers.
+ *
+ *  @return
+ *      `false` if the file could not be written.
+ */
+inline bool generateInput(const std::string path, const std::string kind, const unsigned long long size) {
+	std::ifstream existing(path.c_str(), std::ios::binary | std::ios::ate);
+	if (existing.is_open() && (unsigned long long) existing.tellg() == size) {
+		return true;
+	}
+	existing.close();
+
+	std::ofstream ofs(path.c_str(), std::ios::binary | std::ios::trunc);
+	Random rand(size + kind.length());
+	std::vector<char> block(1024 * 1024);
+	unsigned long long written = 0;
+
+	if (kind == "png") {
+		static const char head[] = "\x89PNG\r\n\x1a\n\0\0\0\x0dIHDR\0\0\x04\0\0\0\x04\0\x08\x06\0\0\0\0\0\0\0";
+		const size_t head_size = std::min((unsigned long long) sizeof(head) - 1, size);
+		ofs.write(head, head_size);
+		written += head_size;
+	}
+
+	while (written < size) {
+		size_t count = (size_t) std::min((unsigned long long) block.size(), size - written);
+		fillBlock(kind, rand, block.data(), count);
+		if (kind == "png") {
+			// "IDAT" chunk every 32 KB
+			for (size_t pos = (32768 - written % 32768) % 32768; pos + 8 <= count; pos += 32768) {
+				const char chunk_head[] = {0, 0, (char) 0x80, 0, 'I', 'D', 'A', 'T'};
+				std::copy(chunk_head, chunk_head + 8, block.begin() + pos);
+			}
+		}
+		ofs.write(block.data(), count);
+		written += count;
+	}
+
+	ofs.close();
+	return !ofs.fail();
+}
+
+
+/** Parses a size with optional K, M or G suffix. */
+inline unsigned long long parseSize(const std::string value) {
+	char* end = NULL;
+	unsigned long long size = strtoull(value.c_str(), &end, 10);
+	if (*end == 'K' || *end == 'k') size <<= 10;
+	else if (*end == 'M' || *end == 'm') size <<= 20;
+	else if (*end == 'G' || *end == 'g') size <<= 30;
+	return size;
+}
+
+/** Splits a comma separated list. */
+inline std::vector<std::string> splitList(const std::string value) {
+	std::vector<std::string> items;
+	std::stringstream ss(value);
+	std::string item;
+	while (std::getline(ss, item, ',')) {
+		if (!item.empty()) items.push_back(item);
+	}
+	return items;
+}
+
+
+/** Creates a directory if it does not exist. */
+inline void makeDirectory(const std::string dir) {
+#ifdef __WIN32__
+	_mkdir(dir.c_str());
+#else
+	mkdir(dir.c_str(), 0755);
+#endif
+}
+
+
+#endif /* B2H_BENCH_UTIL_H_ */
@@ -0,0 +1,367 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// measures complete conversions of generated input files
+
+#include "convert.h"
+#include "cxxopts.hpp"
+#include "hexenc.h"
+#include "paths.h"
+#include "pipeline.h"
+#include "util.h"
+
+#include "bench_util.h"
+
+#include <algorithm> // max
+#include <chrono>
+#include <cstdio> // remove
+#include <cstdlib> // system
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <x86intrin.h> // __rdtsc
+#define B2H_HAVE_TSC 1
+#else
+#define B2H_HAVE_TSC 0
+#endif
+
+using namespace std;
+
+
+/** Options passed to `convert` for one measurement. */
+struct Config {
+	unsigned int pack;
+	bool swap;
+	bool content;
+	string eol;
+	unsigned int chunk;
+};
+
+/** Outcome of one measurement. */
+struct Result {
+	string tool;
+	string kind;
+	unsigned long long size;
+	Config cfg;
+	double seconds;
+	double cycles; // per byte (negative if unknown)
+	unsigned long long peak_memory; // 0 if unknown
+};
+
+
+/** Reads the time stamp counter (0 if not available). */
+static unsigned long long readCycles() {
+#if B2H_HAVE_TSC
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+
+/** Converts an input file with the given options, keeping the fastest of a number of runs.
+ *
+ *  @return
+ *      `false` if conversion failed.
+ */
+static bool measureConvert(const string fin, const string fout, const Config& cfg,
+		const unsigned int repeat, Result& result) {
+	result.seconds = -1;
+	result.cycles = -1;
+	result.peak_memory = 0;
+
+	for (unsigned int run = 0; run < repeat; run++) {
+		// conversion adjusts some options to the data, so all are set again
+		setOutputBitLength(cfg.pack);
+		setSwapEndianess(cfg.swap);
+		setShowDataContent(cfg.content);
+		setEol(cfg.eol);
+		setChunkSize(cfg.chunk);
+		setNumberDataPerLine(12);
+		setReadOffset(0);
+		setReadLength(0);
+		resetPeakMemory();
+
+		// progress messages are not measured
+		streambuf* cout_buf = cout.rdbuf(NULL);
+		const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		const unsigned long long start_cycles = readCycles();
+		const int ret = convert(fin, fout, "bench_data");
+		const unsigned long long end_cycles = readCycles();
+		const chrono::steady_clock::time_point end = chrono::steady_clock::now();
+		cout.rdbuf(cout_buf);
+
+		if (ret != 0) {
+			return false;
+		}
+
+		const double seconds = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+		if (result.seconds < 0 || seconds < result.seconds) {
+			result.seconds = seconds;
+			if (B2H_HAVE_TSC && result.size > 0) {
+				result.cycles = (double) (end_cycles - start_cycles) / result.size;
+			}
+		}
+		result.peak_memory = max(result.peak_memory, getPeakMemory());
+	}
+
+	return true;
+}
+
+
+/** Runs `xxd -i` on an input file, keeping the fastest of a number of runs.
+ *
+ *  @return
+ *      `false` if xxd is not available.
+ */
+static bool measureXxd(const string fin, const string fout, const unsigned int repeat, Result& result) {
+#ifdef __WIN32__
+	return false;
+#else
+	static const int available = system("command -v xxd > /dev/null 2>&1");
+	if (available != 0) {
+		return false;
+	}
+
+	result.seconds = -1;
+	result.cycles = -1;
+	result.peak_memory = 0;
+	const string command = "xxd -i \"" + fin + "\" > \"" + fout + "\"";
+	for (unsigned int run = 0; run < repeat; run++) {
+		const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		const int ret = system(command.c_str());
+		const chrono::steady_clock::time_point end = chrono::steady_clock::now();
+		if (ret != 0) {
+			return false;
+		}
+
+		const double seconds = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+		if (result.seconds < 0 || seconds < result.seconds) result.seconds = seconds;
+	}
+
+	return true;
+#endif
+}
+
+
+/** Prints a result as a table row. */
+static void printResult(const Result& result) {
+	const double mbps = result.size / result.seconds / 1e6;
+	cout << left << setw(9) << result.tool << setw(8) << result.kind << right << setw(12) << result.size
+			<< setw(5) << result.cfg.pack << setw(5) << (result.cfg.swap ? "yes" : "no")
+			<< setw(8) << (result.cfg.content ? "yes" : "no") << setw(5) << result.cfg.eol
+			<< setw(9) << result.cfg.chunk << fixed << setprecision(1) << setw(10) << mbps;
+	if (result.cycles >= 0) cout << setprecision(2) << setw(9) << result.cycles;
+	else cout << setw(9) << "-";
+	if (result.peak_memory > 0) cout << setw(11) << formatSize(result.peak_memory);
+	else cout << setw(11) << "-";
+	cout << endl;
+}
+
+
+/** Writes all results as JSON. */
+static void writeJson(ostream& out, const vector<Result>& results, const unsigned int repeat) {
+	out << "{" << endl
+			<< "\t\"benchmark\": \"bin2header_bench\"," << endl
+			<< "\t\"version\": \"" << B2H_VERSION << "\"," << endl
+			<< "\t\"encoder\": \"" << getHexEncoderName() << "\"," << endl
+			<< "\t\"hardware_threads\": " << getHardwareThreads() << "," << endl
+			<< "\t\"repeat\": " << repeat << "," << endl
+			<< "\t\"results\": [" << endl;
+
+	for (size_t idx = 0; idx < results.size(); idx++) {
+		const Result& result = results[idx];
+		out << "\t\t{\"tool\": \"" << result.tool << "\", \"kind\": \"" << result.kind
+				<< "\", \"size\": " << result.size << ", \"pack\": " << result.cfg.pack
+				<< ", \"swap\": " << (result.cfg.swap ? "true" : "false")
+				<< ", \"content\": " << (result.cfg.content ? "true" : "false")
+				<< ", \"eol\": \"" << result.cfg.eol << "\", \"chunk_size\": " << result.cfg.chunk
+				<< setprecision(9) << ", \"seconds\": " << result.seconds
+				<< setprecision(3) << fixed << ", \"mb_per_s\": " << result.size / result.seconds / 1e6
+				<< ", \"cycles_per_byte\": ";
+		if (result.cycles >= 0) out << result.cycles;
+		else out << "null";
+		out << defaultfloat << ", \"peak_memory\": ";
+		if (result.peak_memory > 0) out << result.peak_memory;
+		else out << "null";
+		out << "}" << (idx + 1 < results.size() ? "," : "") << endl;
+	}
+
+	out << "\t]" << endl << "}" << endl;
+}
+
+
+/** Program entry point.
+ *
+ *  Usage: bin2header_bench [--sizes LIST] [--kinds LIST] [--repeat N] [--dir DIR] [--json FILE]
+ */
+int main(int argc, char** argv) {
+	cxxopts::Options options("bin2header_bench", "Measures conversions of generated input files");
+	options.add_options()
+			("h,help", "Print help information & exit")
+			("sizes", "Comma separated input sizes (K/M/G suffixes)",
+					cxxopts::value<string>()->default_value("4K,1M,64M"))
+			("kinds", "Comma separated inputs (random/zero/text/png)",
+					cxxopts::value<string>()->default_value("random,zero,text,png"))
+			("repeat", "Number of runs per measurement (fastest is kept)",
+					cxxopts::value<unsigned int>()->default_value("3"))
+			("dir", "Directory for generated inputs & output",
+					cxxopts::value<string>()->default_value("bench_data"))
+			("json", "Write results as JSON to file (\"-\" for standard output)", cxxopts::value<string>())
+			("no-xxd", "Do not compare with xxd -i");
+
+	cxxopts::ParseResult args;
+	try {
+		args = options.parse(argc, argv);
+	} catch (const cxxopts::OptionParseException& e) {
+		cerr << "ERROR: " << e.what() << endl;
+		return 1;
+	}
+
+	if (args["help"].as<bool>()) {
+		cout << options.help() << endl;
+		return 0;
+	}
+
+	vector<unsigned long long> sizes;
+	const vector<string> size_list = splitList(args["sizes"].as<string>());
+	for (size_t idx = 0; idx < size_list.size(); idx++) {
+		// whole 64 bit words, so every pack size converts all data
+		const unsigned long long size = parseSize(size_list[idx]) & ~7ULL;
+		if (size == 0) {
+			cerr << "ERROR: Invalid size \"" << size_list[idx] << "\"" << endl;
+			return 1;
+		}
+		sizes.push_back(size);
+	}
+
+	const vector<string> kinds = splitList(args["kinds"].as<string>());
+	for (size_t idx = 0; idx < kinds.size(); idx++) {
+		if (kinds[idx] != "random" && kinds[idx] != "zero" && kinds[idx] != "text" && kinds[idx] != "png") {
+			cerr << "ERROR: Unknown input kind \"" << kinds[idx] << "\"" << endl;
+			return 1;
+		}
+	}
+
+	const unsigned int repeat = max(args["repeat"].as<unsigned int>(), 1U);
+	const string dir = args["dir"].as<string>();
+	makeDirectory(dir);
+	const string fout = joinPath(dir, "bench_data.h");
+
+	// human readable table goes to standard error when JSON is written to standard output
+	const bool json_stdout = args.count("json") > 0 && args["json"].as<string>() == "-";
+	streambuf* cout_buf = cout.rdbuf();
+	if (json_stdout) cout.rdbuf(cerr.rdbuf());
+
+	cout << "Encoder: " << getHexEncoderName() << endl;
+	cout << "Repeat:  " << repeat << " (fastest run)" << endl << endl;
+	cout << "tool     input           bytes pack swap content  eol    chunk      MB/s cyc/byte   peak mem" << endl;
+
+	vector<Result> results;
+	const Config base = {8, false, false, "lf", 1024 * 1024};
+	const auto run = [&](const string kind, const unsigned long long size, const Config& cfg) {
+		Result result;
+		result.tool = "convert";
+		result.kind = kind;
+		result.size = size;
+		result.cfg = cfg;
+		const string fin = joinPath(dir, kind + "_" + to_string(size) + ".bin");
+		if (!measureConvert(fin, fout, cfg, repeat, result)) {
+			cerr << "ERROR: Conversion of " << fin << " failed" << endl;
+			return false;
+		}
+		printResult(result);
+		results.push_back(result);
+
+		if (!args["no-xxd"].as<bool>() && cfg.pack == 8 && !cfg.content && cfg.chunk == base.chunk
+				&& cfg.eol == "lf" && measureXxd(fin, fout, repeat, result)) {
+			result.tool = "xxd";
+			result.cycles = -1;
+			result.peak_memory = 0;
+			printResult(result);
+			results.push_back(result);
+		}
+
+		return true;
+	};
+
+	// every input with default options
+	for (size_t kind_idx = 0; kind_idx < kinds.size(); kind_idx++) {
+		for (size_t size_idx = 0; size_idx < sizes.size(); size_idx++) {
+			const string fin = joinPath(dir, kinds[kind_idx] + "_" + to_string(sizes[size_idx]) + ".bin");
+			if (!generateInput(fin, kinds[kind_idx], sizes[size_idx])) {
+				cerr << "ERROR: Could not write " << fin << endl;
+				return 1;
+			}
+			if (!run(kinds[kind_idx], sizes[size_idx], base)) return 1;
+		}
+	}
+
+	// options varied one at a time on the largest input of the first kind
+	const string sweep_kind = kinds.empty() ? "" : kinds[0];
+	unsigned long long sweep_size = 0;
+	for (size_t idx = 0; idx < sizes.size(); idx++) sweep_size = max(sweep_size, sizes[idx]);
+
+	if (!sweep_kind.empty()) {
+		vector<Config> sweep;
+		const unsigned int packs[] = {8, 16, 32, 64};
+		for (unsigned int pack_idx = 0; pack_idx < 4; pack_idx++) {
+			for (int swap = 0; swap < (packs[pack_idx] > 8 ? 2 : 1); swap++) {
+				for (int content = 0; content < 2; content++) {
+					Config cfg = base;
+					cfg.pack = packs[pack_idx];
+					cfg.swap = swap != 0;
+					cfg.content = content != 0;
+					if (cfg.pack != 8 || cfg.content) sweep.push_back(cfg);
+				}
+			}
+		}
+
+		const char* eols[] = {"cr", "crlf"};
+		for (unsigned int idx = 0; idx < 2; idx++) {
+			Config cfg = base;
+			cfg.eol = eols[idx];
+			sweep.push_back(cfg);
+		}
+
+		const unsigned int chunks[] = {64 * 1024, 256 * 1024, 4 * 1024 * 1024, 16 * 1024 * 1024};
+		for (unsigned int idx = 0; idx < 4; idx++) {
+			Config cfg = base;
+			cfg.chunk = chunks[idx];
+			sweep.push_back(cfg);
+		}
+
+		cout << endl;
+		for (size_t idx = 0; idx < sweep.size(); idx++) {
+			if (!run(sweep_kind, sweep_size, sweep[idx])) return 1;
+		}
+	}
+
+	remove(fout.c_str());
+	cout.rdbuf(cout_buf);
+
+	if (args.count("json") > 0) {
+		const string json_path = args["json"].as<string>();
+		if (json_stdout) {
+			writeJson(cout, results, repeat);
+		} else {
+			ofstream ofs(json_path.c_str());
+			writeJson(ofs, results, repeat);
+			ofs.close();
+			if (ofs.fail()) {
+				cerr << "ERROR: Could not write " << json_path << endl;
+				return 1;
+			}
+			cout << endl << "Results written to " << json_path << endl;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,365 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// measures cost of compiling generated headers for each format option
+
+#include "convert.h"
+#include "cxxopts.hpp"
+#include "paths.h"
+#include "util.h"
+
+#include "bench_util.h"
+
+#include <algorithm> // max
+#include <chrono>
+#include <cstdio> // remove
+#include <cstdlib> // getenv,system
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef __WIN32__
+#include <sys/resource.h> // rusage
+#include <sys/wait.h> // wait4
+#include <unistd.h> // execvp,fork
+#endif
+
+using namespace std;
+
+
+/** Format options of one generated header. */
+struct Config {
+	string format;
+	unsigned int pack;
+	bool content;
+	unsigned int nbdata;
+};
+
+/** Outcome of compiling one header. */
+struct Result {
+	string lang;
+	unsigned long long size;
+	Config cfg;
+	unsigned long long header_size;
+	double seconds;
+	unsigned long long peak_memory; // 0 if unknown
+	unsigned long long object_size;
+};
+
+
+/** Retrieves size of a file (0 if it does not exist). */
+static unsigned long long getFileSize(const string path) {
+	ifstream ifs(path.c_str(), ios::binary | ios::ate);
+	return ifs.is_open() ? (unsigned long long) ifs.tellg() : 0;
+}
+
+
+/** Splits a command line at spaces. */
+static vector<string> splitCommand(const string command) {
+	vector<string> items;
+	stringstream ss(command);
+	string item;
+	while (ss >> item) {
+		items.push_back(item);
+	}
+	return items;
+}
+
+
+/** Runs the compiler, measuring wall time & peak memory of the compiler processes.
+ *
+ *  @tparam vector<string> command
+ *      Program & arguments.
+ *  @tparam double seconds
+ *      Set to wall time.
+ *  @tparam long long peak_memory
+ *      Set to peak memory (0 if not supported on this system).
+ *  @return
+ *      `false` if compiling failed.
+ */
+static bool runCompiler(const vector<string> command, double& seconds, unsigned long long& peak_memory) {
+	peak_memory = 0;
+	const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+#ifdef __WIN32__
+	string line;
+	for (size_t idx = 0; idx < command.size(); idx++) {
+		line += (idx > 0 ? " \"" : "\"") + command[idx] + "\"";
+	}
+	const bool success = system(line.c_str()) == 0;
+#else
+	const pid_t pid = fork();
+	if (pid < 0) {
+		return false;
+	} else if (pid == 0) {
+		vector<char*> argv;
+		for (size_t idx = 0; idx < command.size(); idx++) {
+			argv.push_back(const_cast<char*>(command[idx].c_str()));
+		}
+		argv.push_back(NULL);
+		execvp(argv[0], argv.data());
+		_exit(127);
+	}
+
+	// includes processes started by the compiler driver (Linux)
+	int status = 0;
+	struct rusage usage;
+	if (wait4(pid, &status, 0, &usage) < 0) {
+		return false;
+	}
+	const bool success = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+#ifdef __APPLE__
+	peak_memory = usage.ru_maxrss;
+#else
+	// reported in kilobytes
+	peak_memory = (unsigned long long) usage.ru_maxrss * 1024;
+#endif
+#endif
+
+	const chrono::steady_clock::time_point end = chrono::steady_clock::now();
+	seconds = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+	return success;
+}
+
+
+/** Prints a result as a table row. */
+static void printResult(const Result& result) {
+	cout << left << setw(5) << result.lang << right << setw(10) << result.size << setw(8) << result.cfg.format
+			<< setw(5) << result.cfg.pack << setw(8) << (result.cfg.content ? "yes" : "no")
+			<< setw(7) << result.cfg.nbdata << setw(11) << formatSize(result.header_size)
+			<< fixed << setprecision(3) << setw(9) << result.seconds;
+	if (result.peak_memory > 0) cout << setw(11) << formatSize(result.peak_memory);
+	else cout << setw(11) << "-";
+	cout << setw(11) << formatSize(result.object_size) << endl;
+}
+
+
+/** Writes all results as JSON. */
+static void writeJson(ostream& out, const vector<Result>& results, const string cc, const string cxx,
+		const string flags, const unsigned int repeat) {
+	out << "{" << endl
+			<< "\t\"benchmark\": \"compile_bench\"," << endl
+			<< "\t\"version\": \"" << B2H_VERSION << "\"," << endl
+			<< "\t\"cc\": \"" << cc << "\"," << endl
+			<< "\t\"cxx\": \"" << cxx << "\"," << endl
+			<< "\t\"flags\": \"" << flags << "\"," << endl
+			<< "\t\"repeat\": " << repeat << "," << endl
+			<< "\t\"results\": [" << endl;
+
+	for (size_t idx = 0; idx < results.size(); idx++) {
+		const Result& result = results[idx];
+		out << "\t\t{\"lang\": \"" << result.lang << "\", \"size\": " << result.size
+				<< ", \"format\": \"" << result.cfg.format << "\", \"pack\": " << result.cfg.pack
+				<< ", \"content\": " << (result.cfg.content ? "true" : "false")
+				<< ", \"nbdata\": " << result.cfg.nbdata << ", \"header_size\": " << result.header_size
+				<< setprecision(6) << fixed << ", \"seconds\": " << result.seconds << defaultfloat
+				<< ", \"peak_memory\": ";
+		if (result.peak_memory > 0) out << result.peak_memory;
+		else out << "null";
+		out << ", \"object_size\": " << result.object_size << "}"
+				<< (idx + 1 < results.size() ? "," : "") << endl;
+	}
+
+	out << "\t]" << endl << "}" << endl;
+}
+
+
+/** Program entry point.
+ *
+ *  Usage: compile_bench [--sizes LIST] [--cc CC] [--cxx CXX] [--flags FLAGS] [--json FILE]
+ */
+int main(int argc, char** argv) {
+	// compilers of the build are used unless overridden by the environment
+	const char* env_cc = getenv("CC");
+	const char* env_cxx = getenv("CXX");
+	const string default_cc = env_cc != NULL ? env_cc : "cc";
+	const string default_cxx = env_cxx != NULL ? env_cxx : B2H_CXX_COMPILER;
+
+	cxxopts::Options options("compile_bench", "Measures compiling of generated headers");
+	options.add_options()
+			("h,help", "Print help information & exit")
+			("sizes", "Comma separated input sizes (K/M/G suffixes)",
+					cxxopts::value<string>()->default_value("64K,1M,8M"))
+			("langs", "Comma separated languages (c/c++)", cxxopts::value<string>()->default_value("c,c++"))
+			("cc", "C compiler", cxxopts::value<string>()->default_value(default_cc))
+			("cxx", "C++ compiler", cxxopts::value<string>()->default_value(default_cxx))
+			("flags", "Compiler flags", cxxopts::value<string>()->default_value("-O2"))
+			("repeat", "Number of compilations per header (fastest is kept)",
+					cxxopts::value<unsigned int>()->default_value("1"))
+			("dir", "Directory for generated inputs, headers & objects",
+					cxxopts::value<string>()->default_value("bench_data"))
+			("json", "Write results as JSON to file (\"-\" for standard output)", cxxopts::value<string>());
+
+	cxxopts::ParseResult args;
+	try {
+		args = options.parse(argc, argv);
+	} catch (const cxxopts::OptionParseException& e) {
+		cerr << "ERROR: " << e.what() << endl;
+		return 1;
+	}
+
+	if (args["help"].as<bool>()) {
+		cout << options.help() << endl;
+		return 0;
+	}
+
+	vector<unsigned long long> sizes;
+	const vector<string> size_list = splitList(args["sizes"].as<string>());
+	for (size_t idx = 0; idx < size_list.size(); idx++) {
+		// whole 32 bit words, so every pack size holds all data
+		const unsigned long long size = parseSize(size_list[idx]) & ~3ULL;
+		if (size == 0) {
+			cerr << "ERROR: Invalid size \"" << size_list[idx] << "\"" << endl;
+			return 1;
+		}
+		sizes.push_back(size);
+	}
+
+	const vector<string> langs = splitList(args["langs"].as<string>());
+	for (size_t idx = 0; idx < langs.size(); idx++) {
+		if (langs[idx] != "c" && langs[idx] != "c++") {
+			cerr << "ERROR: Unknown language \"" << langs[idx] << "\"" << endl;
+			return 1;
+		}
+	}
+
+	const string cc = args["cc"].as<string>();
+	const string cxx = args["cxx"].as<string>();
+	const string flags = args["flags"].as<string>();
+	const unsigned int repeat = max(args["repeat"].as<unsigned int>(), 1U);
+	const string dir = args["dir"].as<string>();
+	makeDirectory(dir);
+
+	// every option varied from the defaults on its own
+	vector<Config> configs;
+	const Config base = {"array", 8, false, 12};
+	configs.push_back(base);
+	const unsigned int packs[] = {16, 32};
+	for (unsigned int idx = 0; idx < 2; idx++) {
+		Config cfg = base;
+		cfg.pack = packs[idx];
+		configs.push_back(cfg);
+	}
+	Config content_cfg = base;
+	content_cfg.content = true;
+	configs.push_back(content_cfg);
+	const unsigned int nbdatas[] = {4, 32, 128};
+	for (unsigned int idx = 0; idx < 3; idx++) {
+		Config cfg = base;
+		cfg.nbdata = nbdatas[idx];
+		configs.push_back(cfg);
+	}
+	Config string_cfg = base;
+	string_cfg.format = "string";
+	string_cfg.nbdata = 64;
+	configs.push_back(string_cfg);
+
+	// human readable table goes to standard error when JSON is written to standard output
+	const bool json_stdout = args.count("json") > 0 && args["json"].as<string>() == "-";
+	streambuf* cout_buf = cout.rdbuf();
+	if (json_stdout) cout.rdbuf(cerr.rdbuf());
+
+	cout << "C compiler:   " << cc << endl;
+	cout << "C++ compiler: " << cxx << endl;
+	cout << "Flags:        " << flags << endl << endl;
+	cout << "lang      bytes  format pack content nbdata     header  seconds   peak mem     object" << endl;
+
+	const string header = joinPath(dir, "compile_data.h");
+	const string object = joinPath(dir, "compile_data.o");
+	vector<Result> results;
+	for (size_t size_idx = 0; size_idx < sizes.size(); size_idx++) {
+		const string fin = joinPath(dir, "random_" + to_string(sizes[size_idx]) + ".bin");
+		if (!generateInput(fin, "random", sizes[size_idx])) {
+			cerr << "ERROR: Could not write " << fin << endl;
+			return 1;
+		}
+
+		for (size_t cfg_idx = 0; cfg_idx < configs.size(); cfg_idx++) {
+			const Config& cfg = configs[cfg_idx];
+			setOutputFormat(cfg.format);
+			setOutputBitLength(cfg.pack);
+			setShowDataContent(cfg.content);
+			setNumberDataPerLine(cfg.nbdata);
+
+			streambuf* convert_buf = cout.rdbuf(NULL);
+			const int ret = convert(fin, header, "compile_data");
+			cout.rdbuf(convert_buf);
+			if (ret != 0) {
+				cerr << "ERROR: Conversion of " << fin << " failed" << endl;
+				return 1;
+			}
+
+			for (size_t lang_idx = 0; lang_idx < langs.size(); lang_idx++) {
+				// exported function keeps the data from being discarded
+				const bool cplusplus = langs[lang_idx] == "c++";
+				const string source = joinPath(dir, cplusplus ? "compile_data.cpp" : "compile_data.c");
+				ofstream ofs(source.c_str());
+				ofs << "#include \"compile_data.h\"" << endl << endl
+						<< (cplusplus ? "extern \"C\" " : "") << "const void* compile_data_ref(void) {" << endl
+						<< "\treturn compile_data;" << endl << "}" << endl;
+				ofs.close();
+
+				vector<string> command;
+				command.push_back(cplusplus ? cxx : cc);
+				const vector<string> flag_list = splitCommand(flags);
+				command.insert(command.end(), flag_list.begin(), flag_list.end());
+				command.push_back("-c");
+				command.push_back(source);
+				command.push_back("-o");
+				command.push_back(object);
+
+				Result result;
+				result.lang = langs[lang_idx];
+				result.size = sizes[size_idx];
+				result.cfg = cfg;
+				result.header_size = getFileSize(header);
+				result.seconds = -1;
+				result.peak_memory = 0;
+				for (unsigned int run = 0; run < repeat; run++) {
+					double seconds;
+					unsigned long long peak_memory;
+					remove(object.c_str());
+					if (!runCompiler(command, seconds, peak_memory)) {
+						cerr << "ERROR: Compiling " << source << " with " << command[0] << " failed" << endl;
+						return 1;
+					}
+					if (result.seconds < 0 || seconds < result.seconds) result.seconds = seconds;
+					result.peak_memory = max(result.peak_memory, peak_memory);
+				}
+				result.object_size = getFileSize(object);
+
+				printResult(result);
+				results.push_back(result);
+				remove(source.c_str());
+			}
+		}
+	}
+
+	remove(header.c_str());
+	remove(object.c_str());
+	cout.rdbuf(cout_buf);
+
+	if (args.count("json") > 0) {
+		const string json_path = args["json"].as<string>();
+		if (json_stdout) {
+			writeJson(cout, results, cc, cxx, flags, repeat);
+		} else {
+			ofstream ofs(json_path.c_str());
+			writeJson(ofs, results, cc, cxx, flags, repeat);
+			ofs.close();
+			if (ofs.fail()) {
+				cerr << "ERROR: Could not write " << json_path << endl;
+				return 1;
+			}
+			cout << endl << "Results written to " << json_path << endl;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,83 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// measures cost of formatting array body lines for each layout variant
+
+#include "format.h"
+#include "hexenc.h"
+
+#include <chrono>
+#include <cstdlib> // atoi,rand,srand
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+
+/** Formats a buffer repeatedly & returns nanoseconds per input byte. */
+static double measure(const vector<unsigned char>& data, const LineFormat& fmt,
+		const unsigned int rounds) {
+	string text;
+	text.reserve(formattedSize(data.size(), fmt, true) + 256);
+
+	// warm up caches & page in output buffer
+	formatLines(text, data.data(), data.size(), fmt, true);
+
+	const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (unsigned int idx = 0; idx < rounds; idx++) {
+		text.clear();
+		formatLines(text, data.data(), data.size(), fmt, true);
+	}
+	const chrono::steady_clock::time_point end = chrono::steady_clock::now();
+
+	const double ns = chrono::duration_cast<chrono::nanoseconds>(end - start).count();
+	return ns / ((double) data.size() * rounds);
+}
+
+
+/** Program entry point.
+ *
+ *  Usage: format_bench [size in bytes] [rounds]
+ */
+int main(int argc, char** argv) {
+	const size_t size = argc > 1 ? atoi(argv[1]) : 4 * 1024 * 1024;
+	const unsigned int rounds = argc > 2 ? atoi(argv[2]) : 10;
+
+	// fixed seed keeps runs comparable
+	vector<unsigned char> data(size - size % 8);
+	srand(1);
+	for (size_t idx = 0; idx < data.size(); idx++) {
+		data[idx] = rand() & 0xff;
+	}
+
+	cout << "Encoder: " << getHexEncoderName() << endl;
+	cout << "Input:   " << data.size() << " bytes x " << rounds << " rounds" << endl << endl;
+	cout << "pack  swap  content  ns/byte   MB/s" << endl;
+
+	const unsigned int sizes[] = {1, 2, 4, 8};
+	for (unsigned int size_idx = 0; size_idx < 4; size_idx++) {
+		for (int swap = 0; swap < 2; swap++) {
+			for (int content = 0; content < 2; content++) {
+				const LineFormat fmt = {sizes[size_idx], 12, swap != 0, content != 0, "\n", false};
+				const double ns = measure(data, fmt, rounds);
+
+				cout << setw(4) << sizes[size_idx] * 8 << setw(6) << (swap ? "yes" : "no")
+						<< setw(9) << (content ? "yes" : "no") << fixed << setprecision(3)
+						<< setw(9) << ns << setprecision(1) << setw(7) << 1000 / ns << endl;
+			}
+		}
+	}
+
+	// string literals, 64 bytes per line
+	const LineFormat fmt = {1, 64, false, false, "\n", true};
+	const double ns = measure(data, fmt, rounds);
+	cout << endl << "string literals" << fixed << setprecision(3) << setw(12) << ns
+			<< setprecision(1) << setw(7) << 1000 / ns << endl;
+
+	return 0;
+}
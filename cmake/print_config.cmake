@@ -37,6 +37,7 @@ if(NATIVE)
 	message(STATUS "C++ standard ...... ${CMAKE_CXX_STANDARD}")
 	#message(STATUS "Architecture ...... ")
 	message(STATUS "Statically link ... ${STATIC}")
+	message(STATUS "Benchmarks ........ ${BENCHMARKS}")
 	message(STATUS "Embed icon ........ ${EMBED_ICON} (Windows only)")
 else()
 	message(STATUS "Build type ... ${build_type}")
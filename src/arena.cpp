@@ -0,0 +1,78 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+#include "arena.h"
+
+#include <cstdlib> // malloc,free
+
+#ifndef __WIN32__
+#include <sys/mman.h> // mmap,madvise
+#endif
+
+using namespace std;
+
+
+BufferArena::BufferArena() : base(NULL), length(0), used(0) {}
+
+BufferArena::~BufferArena() {
+	free();
+}
+
+
+bool BufferArena::allocate(const size_t size, const bool huge) {
+	free();
+	if (size == 0) {
+		return true;
+	}
+
+#ifdef __WIN32__
+	base = (char*) malloc(size);
+	if (base == NULL) {
+		return false;
+	}
+#else
+	void* addr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (addr == MAP_FAILED) {
+		return false;
+	}
+
+#ifdef MADV_HUGEPAGE
+	// fewer TLB misses when streaming through large chunks
+	if (huge) madvise(addr, size, MADV_HUGEPAGE);
+#endif
+
+	base = (char*) addr;
+#endif
+
+	length = size;
+	used = 0;
+	return true;
+}
+
+
+void BufferArena::free() {
+	if (base != NULL) {
+#ifdef __WIN32__
+		::free(base);
+#else
+		munmap(base, length);
+#endif
+	}
+	base = NULL;
+	length = 0;
+	used = 0;
+}
+
+
+char* BufferArena::take(const size_t size) {
+	if (size > length - used) {
+		return NULL;
+	}
+
+	char* block = base + used;
+	used += size;
+	return block;
+}
@@ -8,13 +8,16 @@
 #include "convert.h"
 #include "cxxopts.hpp"
 #include "paths.h"
+#include "util.h"
 
 #include <cerrno>
 #include <cctype> // toupper
+#include <fstream>
 #include <iostream>
 #include <sstream>
 #include <string>
 #include <unistd.h> // access,F_OK
+#include <vector>
 
 using namespace std;
 
@@ -38,11 +41,15 @@ void printVersion() {
 /** Prints usage information. */
 void printUsage() {
 	printVersion();
-	cout << "\n  Usage:\n\t" << executable << " [options] <file>" << endl;
+	cout << "\n  Usage:\n\t" << executable << " [options] <file> [<file> ...]" << endl;
+	cout << "\n\tUse \"-\" as <file> to read from standard input (written to" << endl;
+	cout << "\tstandard output unless --output is set)." << endl;
+	cout << "\n\tSeveral files are converted concurrently. Use \"@<listfile>\" to" << endl;
+	cout << "\tread names of files to convert from a text file (one per line)." << endl;
 	cout << "\n  Options:" << endl;
 	cout << "\t-h, --help\t\tPrint help information & exit." << endl;
 	cout << "\t-v, --version\t\tPrint version information & exit." << endl;
-	cout << "\t-o, --output\t\tOutput file name." << endl;
+	cout << "\t-o, --output\t\tOutput file name (\"-\" for standard output), or directory for several files." << endl;
 	cout << "\t-n, --hname\t\tHeader name. Default is file name with \".\" replaced by \"_\"." << endl;
 	cout << "\t-s, --chunksize\t\tRead buffer chunk size (in bytes)." << endl;
 	cout << "\t\t\t\t  Default: 1048576 (1 megabyte)" << endl;
@@ -53,10 +60,31 @@ void printUsage() {
 	cout << "\t\t\t\t  Default: 0" << endl;
 	cout << "\t-l  --length\t\tNumber of bytes to process (0 = all)." << endl;
 	cout << "\t\t\t\t  Default: 0" << endl;
-	cout << "\t-p  --pack\t\tStored data type bit length (8/16/32)." << endl;
+	cout << "\t-p  --pack\t\tStored data type bit length (8/16/32/64)." << endl;
 	cout << "\t\t\t\t  Default: 8" << endl;
-	cout << "\t-e  --swap\t\tSet endianess to big endian for 16 & 32 bit data types." << endl;
+	cout << "\t-e  --swap\t\tSet endianess to big endian for 16, 32 & 64 bit data types." << endl;
+	cout << "\t-j  --jobs\t\tNumber of threads formatting data, or converting several files (0 = one per CPU core)." << endl;
+	cout << "\t\t\t\t  Default: 1" << endl;
+	cout << "\t    --readahead\t\tNumber of chunks read ahead of formatting (0 = none)." << endl;
+	cout << "\t\t\t\t  Default: 2" << endl;
+	cout << "\t    --hugepages\t\tBack read buffers with transparent huge pages (Linux)." << endl;
+	cout << "\t    --format\t\tData representation (array/string/embed/incbin/elf64/elf32)." << endl;
+	cout << "\t\t\t\t  Default: array" << endl;
+	cout << "\t    --embed-fallback\tWrite array for compilers without #embed." << endl;
+	cout << "\t    --split\t\tDeclare data in header & define it in a separate source." << endl;
+	cout << "\t    --shard-size\tDefine data in separate sources of at most this many bytes." << endl;
+	cout << "\t    --align\t\tAlign data to this many bytes (power of two, 0 = natural)." << endl;
+	cout << "\t\t\t\t  Default: 0" << endl;
+	cout << "\t    --section\t\tPlace data in this linker section." << endl;
+	cout << "\t    --skip-unchanged\tKeep output written from the same data & options." << endl;
+	cout << "\t    --cache-dir\t\tDirectory where outputs are cached between builds." << endl;
+	cout << "\t    --cache-size\tSize limit of the cache in bytes (0 = unlimited)." << endl;
+	cout << "\t\t\t\t  Default: 1073741824 (1 gigabyte)" << endl;
+	cout << "\t    --index\t\tWrite header finding data of all files by name." << endl;
+	cout << "\t    --bundle\t\tStore all files below a directory in one array with an index." << endl;
 	cout << "\t    --stdvector\t\tAdditionally store data in std::vector for C++." << endl;
+	cout << "\t    --view\t\tAdditionally refer to data without copying it (none/span/string_view/struct)." << endl;
+	cout << "\t\t\t\t  Default: none" << endl;
 	cout << "\t    --eol\t\tSet end of line character (cr/lf/crlf)." << endl;
 	cout << "\t\t\t\t  Default: lf" << endl;
 }
@@ -89,6 +117,35 @@ void exitWithError(const int code, const string msg) {
 }
 
 
+/** Reads names of input files from a list file.
+ *
+ *  @tparam string path
+ *      List file with one name per line (empty lines are ignored).
+ *  @tparam vector<string> files
+ *      Names are appended.
+ *  @return
+ *      `false` if list file cannot be read.
+ */
+bool readListFile(const string path, vector<string>& files) {
+	ifstream ifs(path.c_str());
+	if (!ifs.is_open()) {
+		return false;
+	}
+
+	string line;
+	while (getline(ifs, line)) {
+		if (!line.empty() && line[line.length() - 1] == '\r') {
+			line.erase(line.length() - 1);
+		}
+		if (!checkEmptyString(line)) {
+			files.push_back(normalizePath(line));
+		}
+	}
+
+	return !ifs.bad();
+}
+
+
 /** Program entry point.
  *
  *  @tparam int argc
@@ -117,7 +174,22 @@ int main(int argc, char** argv) {
 			("l,length", "", cxxopts::value<unsigned long>())
 			("p,pack", "", cxxopts::value<unsigned int>())
 			("e,swap", "")
+			("j,jobs", "", cxxopts::value<unsigned int>())
+			("readahead", "", cxxopts::value<unsigned int>())
+			("hugepages", "")
+			("format", "", cxxopts::value<string>())
+			("embed-fallback", "")
+			("split", "")
+			("shard-size", "", cxxopts::value<unsigned long long>())
+			("align", "", cxxopts::value<unsigned int>())
+			("section", "", cxxopts::value<string>())
+			("skip-unchanged", "")
+			("cache-dir", "", cxxopts::value<string>())
+			("cache-size", "", cxxopts::value<unsigned long long>())
+			("index", "", cxxopts::value<string>())
+			("bundle", "", cxxopts::value<string>())
 			("stdvector", "")
+			("view", "", cxxopts::value<string>())
 			("eol", "", cxxopts::value<string>());
 
 	cxxopts::ParseResult args;
@@ -167,33 +239,64 @@ int main(int argc, char** argv) {
 		setSwapEndianess();
 	}
 
-	if (args.count("eol") > 0) {
-		setEol(args["eol"].as<string>());
+	if (args.count("jobs") > 0) {
+		setJobs(args["jobs"].as<unsigned int>());
 	}
 
-	// too many input files
-	// XXX: should we allow multiple inputs?
-	#if 0	/* Multiple switches */
-	if (argc > 2) {
-		exitWithError(E2BIG, "Too many input files specified", true);
+	if (args.count("readahead") > 0) {
+		setReadAhead(args["readahead"].as<unsigned int>());
 	}
-	#endif
 
-	if (argc < 2) {
-		// FIXME: correct error return code
-		exitWithError(1, "Missing <file> argument", true);
+	if (args["hugepages"].as<bool>()) {
+		setHugePages(true);
+	}
+
+	if (args.count("format") > 0 && !setOutputFormat(args["format"].as<string>())) {
+		ss << "Unknown format \"" << args["format"].as<string>() << "\"";
+		exitWithError(EINVAL, ss.str(), true);
 	}
 
-	// only remaining argument should be input file
-	string source_file = normalizePath(argv[argc-1]);
+	if (args["embed-fallback"].as<bool>()) {
+		setEmbedFallback(true);
+	}
 
-	// check if source file exists
-	if (access(source_file.c_str(), F_OK) == -1) {
-		// clear stringstream
-		ss.str("");
-		ss << "File \"" << source_file << "\" does not exist";
+	if (args["split"].as<bool>()) {
+		setSplitOutput(true);
+	}
 
-		exitWithError(ENOENT, ss.str(), true);
+	if (args.count("shard-size") > 0) {
+		setShardSize(args["shard-size"].as<unsigned long long>());
+	}
+
+	if (args.count("align") > 0 && !setDataAlignment(args["align"].as<unsigned int>())) {
+		ss << "Alignment must be a power of two: " << args["align"].as<unsigned int>();
+		exitWithError(EINVAL, ss.str(), true);
+	}
+
+	if (args.count("section") > 0 && !setDataSection(args["section"].as<string>())) {
+		ss << "Invalid section name \"" << args["section"].as<string>() << "\"";
+		exitWithError(EINVAL, ss.str(), true);
+	}
+
+	if (args["skip-unchanged"].as<bool>()) {
+		setSkipUnchanged(true);
+	}
+
+	if (args.count("cache-dir") > 0) {
+		setCacheDir(normalizePath(args["cache-dir"].as<string>()), version);
+	}
+
+	if (args.count("cache-size") > 0) {
+		setCacheSize(args["cache-size"].as<unsigned long long>());
+	}
+
+	if (args.count("view") > 0 && !setDataView(args["view"].as<string>())) {
+		ss << "Unknown view \"" << args["view"].as<string>() << "\"";
+		exitWithError(EINVAL, ss.str(), true);
+	}
+
+	if (args.count("eol") > 0) {
+		setEol(args["eol"].as<string>());
 	}
 
 	string hname = "";
@@ -206,5 +309,68 @@ int main(int argc, char** argv) {
 		target_file = args["output"].as<string>();
 	}
 
+	if (args.count("bundle") > 0) {
+		const string bundle_dir = normalizePath(args["bundle"].as<string>());
+		if (!args.unmatched().empty()) {
+			exitWithError(EINVAL, "Input files cannot be converted with a bundle", true);
+		} else if (args["stdvector"].as<bool>()) {
+			exitWithError(EINVAL, "Bundles cannot be stored in std::vector", true);
+		} else if (access(bundle_dir.c_str(), F_OK) == -1) {
+			ss << "Directory \"" << bundle_dir << "\" does not exist";
+			exitWithError(ENOENT, ss.str(), false);
+		}
+
+		exit(convertBundle(bundle_dir, target_file, hname));
+	}
+
+	// input files, with names read from list files
+	vector<string> source_files;
+	bool batch = false;
+	const vector<string> inputs = args.unmatched();
+	for (size_t idx = 0; idx < inputs.size(); idx++) {
+		if (inputs[idx].length() > 1 && inputs[idx][0] == '@') {
+			batch = true;
+			if (!readListFile(inputs[idx].substr(1), source_files)) {
+				ss << "Cannot read list file \"" << inputs[idx].substr(1) << "\"";
+				exitWithError(ENOENT, ss.str(), false);
+			}
+		} else {
+			source_files.push_back(normalizePath(inputs[idx]));
+		}
+	}
+	batch = batch || source_files.size() > 1 || args.count("index") > 0;
+
+	if (source_files.empty()) {
+		// FIXME: correct error return code
+		exitWithError(1, "Missing <file> argument", !batch);
+	}
+
+	if (batch) {
+		if (!hname.empty()) {
+			exitWithError(EINVAL, "Header name cannot be set for several files", true);
+		} else if (!target_file.empty() && access(target_file.c_str(), F_OK) == -1) {
+			ss << "Output directory \"" << target_file << "\" does not exist";
+			exitWithError(ENOENT, ss.str(), false);
+		}
+
+		string index_file = "";
+		if (args.count("index") > 0) {
+			index_file = normalizePath(args["index"].as<string>());
+		}
+
+		exit(convertBatch(source_files, target_file, args["stdvector"].as<bool>(), index_file));
+	}
+
+	const string source_file = source_files[0];
+
+	// check if source file exists ("-" reads from standard input)
+	if (source_file != "-" && access(source_file.c_str(), F_OK) == -1) {
+		// clear stringstream
+		ss.str("");
+		ss << "File \"" << source_file << "\" does not exist";
+
+		exitWithError(ENOENT, ss.str(), true);
+	}
+
 	exit(convert(source_file, target_file, hname, args["stdvector"].as<bool>()));
 }
@@ -122,9 +122,9 @@ def printUsage():
 			+ "\n\t\t\t\t  Default: {}".format(getOpt("offset", True)[1])
 			+ "\n\t-l, --length\t\tNumber of bytes to process (0 = all)."
 			+ "\n\t\t\t\t  Default: {}".format(getOpt("length", True)[1])
-			+ "\n\t-p, --pack\t\tStored data type bit length (8/16/32)."
+			+ "\n\t-p, --pack\t\tStored data type bit length (8/16/32/64)."
 			+ "\n\t\t\t\t  Default: {}".format(getOpt("pack", True)[1])
-			+ "\n\t-e, --swap\t\tSet endianess to big endian for 16 & 32 bit data types."
+			+ "\n\t-e, --swap\t\tSet endianess to big endian for 16, 32 & 64 bit data types."
 			+ "\n\t    --stdvector\t\tAdditionally store data in std::vector for C++."
 			+ "\n\t    --eol\t\tSet end of line character (cr/lf/crlf)."
 			+ "\n\t\t\t\t  Default: {}".format(getOpt("eol", True)[1]))
@@ -458,8 +458,8 @@ def toPrintableChar(c):
 #      Flag to additionally store data in C++ std::vector.
 def convert(fin, fout, hname="", stdvector=False):
 	outlen = getOpt("pack")[1]
-	if (outlen > 32 or outlen % 8 != 0):
-		exitWithError(-1, "Unsupported pack size, must be 8, 16, or 32")
+	if outlen not in (8, 16, 32, 64):
+		exitWithError(-1, "Unsupported pack size, must be 8, 16, 32, or 64")
 
 	swap_bytes = getOpt("swap")[1]
 
@@ -581,7 +581,9 @@ def convert(fin, fout, hname="", stdvector=False):
 			text += "{0}#ifdef __cplusplus{0}#include <vector>{0}#endif{0}".format(eol)
 
 		data_type = "char"
-		if outlen == 32:
+		if outlen == 64:
+			data_type = "long long"
+		elif outlen == 32:
 			data_type = "int"
 		elif outlen == 16:
 			data_type = "short"
@@ -641,7 +643,11 @@ def convert(fin, fout, hname="", stdvector=False):
 				byte_idx += wordbytes
 
 				if showDataContent:
-					comment += toPrintableChar(chunk[byte_idx - 1])
+					c = toPrintableChar(chunk[byte_idx - 1])
+					# "*/" would end the comment early
+					if c == "/" and comment.endswith("*"):
+						c = "."
+					comment += c
 
 				ofs.write("0x{}".format(word))
 				bytes_written += wordbytes
@@ -674,8 +680,10 @@ def convert(fin, fout, hname="", stdvector=False):
 
 		text = "}};{0}".format(eol)
 		if stdvector:
-			text += "{0}#ifdef __cplusplus{0}static const std::vector<char> ".format(eol) \
-			+ hname + "_v(" + hname + ", " + hname + " + sizeof(" + hname \
+			# vectors hold the bytes of packed data
+			vector_begin = hname if outlen == 8 else "(const unsigned char*) " + hname
+			text += "{0}#ifdef __cplusplus{0}static const std::vector<unsigned char> ".format(eol) \
+			+ hname + "_v(" + vector_begin + ", " + vector_begin + " + sizeof(" + hname \
 			+ "));{0}#endif{0}".format(eol)
 		text +="{0}#endif /* {1} */{0}".format(eol, hname_upper)
 
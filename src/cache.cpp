@@ -0,0 +1,217 @@
+
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// large file support on 32 bit systems
+#ifndef _FILE_OFFSET_BITS
+#define _FILE_OFFSET_BITS 64
+#endif
+
+#include "cache.h"
+#include "paths.h"
+#include "threads.h"
+
+#include <algorithm> // sort
+#include <atomic>
+#include <cstdio> // fopen,rename,remove
+#include <ctime>
+#include <sys/stat.h> // mkdir,stat
+#include <unistd.h> // getpid,rmdir,unlink
+#include <utime.h>
+
+#ifdef __linux__
+#include <linux/fs.h> // FICLONE
+#include <sys/ioctl.h>
+#endif
+
+using namespace std;
+
+
+// distinguishes temporary entries written by threads of one process
+static atomic<unsigned int> temp_count(0);
+
+// temporary entries left by interrupted processes are removed after this many seconds
+static const time_t temp_expiry = 24 * 60 * 60;
+
+// size of the cache, scanned by the first insert of the process & grown by
+// each insert, so that the directory is only scanned again to evict entries
+static string tracked_dir;
+static unsigned long long tracked_size = 0;
+#if B2H_THREADS
+static std::mutex tracked_mutex;
+#endif
+
+
+/** Creates a directory, succeeding if it exists. */
+static bool makeDirectory(const string path) {
+#ifdef __WIN32__
+	mkdir(path.c_str());
+#else
+	mkdir(path.c_str(), 0777);
+#endif
+
+	struct stat st;
+	return stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+/** Removes an entry directory & its files. */
+static void removeEntry(const string path) {
+	const vector<string> names = listDirectory(path);
+	for (size_t idx = 0; idx < names.size(); idx++) {
+		unlink(joinPath(path, names[idx]).c_str());
+	}
+	rmdir(path.c_str());
+}
+
+/** Copies a file, replacing the target instead of writing into it.
+ *
+ *  Hard links are not used, as outputs are rewritten in place & would
+ *  modify the cached copy.
+ */
+static bool copyFile(const string source, const string target) {
+	FILE* in = fopen(source.c_str(), "rb");
+	if (in == NULL) {
+		return false;
+	}
+
+	// other links to an existing target keep their content
+	unlink(target.c_str());
+	FILE* out = fopen(target.c_str(), "wb");
+	if (out == NULL) {
+		fclose(in);
+		return false;
+	}
+
+	bool copied = false;
+#ifdef __linux__
+	// copy on write clones share the data blocks (Btrfs, XFS)
+	copied = ioctl(fileno(out), FICLONE, fileno(in)) == 0;
+#endif
+
+	if (!copied) {
+		vector<char> buffer(1024 * 1024);
+		size_t size;
+		copied = true;
+		while (copied && (size = fread(buffer.data(), 1, buffer.size(), in)) > 0) {
+			copied = fwrite(buffer.data(), 1, size, out) == size;
+		}
+		copied = copied && !ferror(in);
+	}
+
+	fclose(in);
+	copied = fclose(out) == 0 && copied;
+	if (!copied) {
+		unlink(target.c_str());
+	}
+
+	return copied;
+}
+
+/** Removes least recently used entries until the cache is within a size.
+ *
+ *  @return
+ *      Size of the remaining entries.
+ */
+static unsigned long long evictEntries(const string dir, const unsigned long long max_size) {
+	struct Entry {
+		string path;
+		time_t used;
+		unsigned long long size;
+	};
+
+	vector<Entry> entries;
+	unsigned long long total = 0;
+	const time_t now = time(NULL);
+	const vector<string> names = listDirectory(dir);
+	for (size_t idx = 0; idx < names.size(); idx++) {
+		Entry entry = {joinPath(dir, names[idx]), 0, 0};
+		struct stat st;
+		if (stat(entry.path.c_str(), &st) != 0 || !S_ISDIR(st.st_mode)) {
+			continue;
+		}
+
+		if (names[idx].compare(0, 4, "tmp-") == 0) {
+			if (now - st.st_mtime > temp_expiry) {
+				removeEntry(entry.path);
+			}
+			continue;
+		}
+
+		entry.used = st.st_mtime;
+		const vector<string> files = listDirectory(entry.path);
+		for (size_t file = 0; file < files.size(); file++) {
+			if (stat(joinPath(entry.path, files[file]).c_str(), &st) == 0) {
+				entry.size += st.st_size;
+			}
+		}
+		total += entry.size;
+		entries.push_back(entry);
+	}
+
+	sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.used < b.used; });
+	for (size_t idx = 0; total > max_size && idx < entries.size(); idx++) {
+		removeEntry(entries[idx].path);
+		total -= entries[idx].size;
+	}
+
+	return total;
+}
+
+
+bool cacheFetch(const string dir, const string key, const vector<string> paths) {
+	const string entry = joinPath(dir, key);
+	for (size_t idx = 0; idx < paths.size(); idx++) {
+		if (!copyFile(joinPath(entry, to_string(idx)), paths[idx])) {
+			return false;
+		}
+	}
+
+	// modification time of the entry orders eviction
+	utime(entry.c_str(), NULL);
+	return true;
+}
+
+bool cacheStore(const string dir, const string key, const vector<string> paths,
+		const unsigned long long max_size) {
+	if (!makeDirectory(dir)) {
+		return false;
+	}
+
+	const string temp = joinPath(dir, "tmp-" + key + "-" + to_string(getpid()) + "-" + to_string(temp_count++));
+	bool stored = makeDirectory(temp);
+	unsigned long long entry_size = 0;
+	for (size_t idx = 0; stored && idx < paths.size(); idx++) {
+		stored = copyFile(paths[idx], joinPath(temp, to_string(idx)));
+
+		struct stat st;
+		if (stored && stat(paths[idx].c_str(), &st) == 0) {
+			entry_size += st.st_size;
+		}
+	}
+
+	// fails if another process stored the same entry first, which holds the same files
+	if (!stored || rename(temp.c_str(), joinPath(dir, key).c_str()) != 0) {
+		removeEntry(temp);
+	}
+
+	if (max_size > 0) {
+#if B2H_THREADS
+		lock_guard<std::mutex> lock(tracked_mutex);
+#endif
+		// evicting below the limit leaves room for inserts before the next scan
+		const unsigned long long low_size = max_size - max_size / 8;
+		if (tracked_dir != dir) {
+			// entries of other processes are counted when the directory is scanned
+			tracked_dir = dir;
+			tracked_size = evictEntries(dir, max_size);
+		} else {
+			if (stored) tracked_size += entry_size;
+			if (tracked_size > max_size) tracked_size = evictEntries(dir, low_size);
+		}
+	}
+
+	return stored;
+}
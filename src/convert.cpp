@@ -5,17 +5,32 @@
  * terms of the MIT/X11 license. See: LICENSE.txt
  */
 
+#include "cache.h"
 #include "convert.h"
+#include "elf.h"
+#include "format.h"
+#include "hash.h"
+#include "input.h"
+#include "output.h"
 #include "paths.h"
+#include "pipeline.h"
+#include "reader.h"
+#include "threads.h"
 #include "util.h"
 
+#include <algorithm> // min
 #include <cerrno>
 #include <cmath> // ceil
 #include <csignal>
+#include <cstdio> // remove
+#include <cstring> // memcpy
 #include <fstream>
-#include <iomanip>
+#include <iomanip> // setw
 #include <iostream>
+#include <set>
 #include <sstream>
+#include <unistd.h> // access,F_OK
+#include <vector>
 
 using namespace std;
 
@@ -24,10 +39,24 @@ unsigned int chunk_size = 1024 * 1024; // buffer size (default: 1MB)
 unsigned int nbData     = 12;          // number of bytes to write per line
 unsigned long offset    = 0;           // position at which to start reading file
 unsigned long length    = 0;           // number of bytes to process (0 = all)
-unsigned int outlen     = 8;           // output data type bit length (8/16/32)
+unsigned int outlen     = 8;           // output data type bit length (8/16/32/64)
 bool showDataContent    = false;       // enable to show data content in comments
 bool swap_bytes         = false;       // enable to swap byte order for bigger types (changes endianess)
 string eol              = "\n";        // end of line character
+unsigned int jobs       = 1;           // number of threads formatting chunks
+unsigned int readahead  = 2;           // number of chunks read ahead of formatting
+bool huge_pages         = false;       // back read buffers with transparent huge pages
+string outformat        = "array";     // representation of data (array/string/embed/incbin/elf64/elf32)
+bool embed_fallback     = false;       // write data as array for compilers without #embed
+bool split              = false;       // write declarations & data definition to separate files
+string dataview         = "none";      // non-owning accessor for the data (none/span/string_view/struct)
+unsigned long long shard_size = 0;     // maximum number of bytes per data source (0 = no sharding)
+unsigned int data_align = 0;           // alignment of the data in bytes (0 = natural)
+string data_section     = "";          // linker section holding the data (empty = default)
+bool skip_unchanged     = false;       // leave output untouched if its fingerprint matches
+string cache_dir        = "";          // directory of outputs shared between builds (empty = none)
+string cache_version    = "";          // program version, part of cache keys
+unsigned long long cache_size = 1024ULL * 1024 * 1024; // size limit of the cache (0 = unlimited)
 
 bool cancelled = false;
 
@@ -37,18 +66,98 @@ void setShowDataContent(const bool dc) { showDataContent = dc; }
 void setOutputBitLength(const unsigned int bl) { outlen = bl; }
 void setReadOffset(const unsigned long ofs) { offset = ofs; }
 void setReadLength(const unsigned long lgt) { length = lgt; }
-void setSwapEndianess() { swap_bytes = true; }
+void setSwapEndianess(const bool sw) { swap_bytes = sw; }
+
+void setJobs(const unsigned int j) {
+	jobs = j > 0 ? j : getHardwareThreads();
+}
+
+void setReadAhead(const unsigned int depth) { readahead = depth; }
+void setHugePages(const bool hp) { huge_pages = hp; }
+void setEmbedFallback(const bool fb) { embed_fallback = fb; }
+void setSplitOutput(const bool sp) { split = sp; }
+
+void setShardSize(const unsigned long long sz) { shard_size = sz; }
+
+void setSkipUnchanged(const bool sk) { skip_unchanged = sk; }
+
+void setCacheDir(const string dir, const string version) {
+	cache_dir = dir;
+	cache_version = version;
+}
+
+void setCacheSize(const unsigned long long sz) { cache_size = sz; }
+
+bool setDataAlignment(const unsigned int al) {
+	if (al & (al - 1)) {
+		return false;
+	}
+
+	data_align = al;
+	return true;
+}
+
+bool setDataSection(const string sec) {
+	// written inside quotes of attributes & directives
+	if (sec.find_first_of("\"\\ \t\r\n") != string::npos) {
+		return false;
+	}
+
+	data_section = sec;
+	return true;
+}
+
+bool setDataView(const string newView) {
+	if (newView != "none" && newView != "span" && newView != "string_view" && newView != "struct") {
+		return false;
+	}
+
+	dataview = newView;
+	return true;
+}
+
+bool setOutputFormat(const string newFormat) {
+	if (newFormat != "array" && newFormat != "string" && newFormat != "embed" && newFormat != "incbin"
+			&& newFormat != "elf64" && newFormat != "elf32") {
+		return false;
+	}
+
+	outformat = newFormat;
+	return true;
+}
 
 void setEol(const string newEol) {
 	if (newEol == "cr") {
 		eol = "\r";
 	} else if (newEol == "crlf") {
 		eol = "\r\n";
-	} else if (newEol != "lf") {
-		cout << "\nWARNING: Unknown EOL type \"" << newEol << "\", using default \"lf\"\n" << endl;
+	} else {
+		if (newEol != "lf") {
+			cout << "\nWARNING: Unknown EOL type \"" << newEol << "\", using default \"lf\"\n" << endl;
+		}
+		eol = "\n";
 	}
 }
 
+/** Sends messages written to standard output to standard error while in scope. */
+class StdoutRedirect {
+public:
+	/** Redirects standard output.
+	 *
+	 *  @tparam bool active
+	 *      `false` leaves standard output unchanged.
+	 */
+	StdoutRedirect(const bool active) : saved(active ? cout.rdbuf(cerr.rdbuf()) : NULL) {}
+
+	/** Restores standard output. */
+	~StdoutRedirect() {
+		if (saved != NULL) cout.rdbuf(saved);
+	}
+
+private:
+	streambuf* saved;
+};
+
 /** Cancels current write iteration. */
 void sigintHandler(int signum) {
 	cout << "\nSignal interrupt caught, cancelling ..." << endl;
@@ -59,82 +168,308 @@ void sigintHandler(int signum) {
 }
 
 
-/** Converts non-printable characters to ".".
+/** Creates assembler source including the data from the input file.
  *
- *  @tparam char c
- *      Character to evaluate.
+ *  @tparam string hname
+ *      Symbol name of the data.
+ *  @tparam string path
+ *      Path to input file.
+ *  @tparam long long length
+ *      Number of bytes to include (starting at `offset`).
  *  @return
- *      Same character or "." non-printable.
+ *      Source to be preprocessed & assembled by GCC or Clang.
  */
-char toPrintableChar(char c) {
-	if (c >= ' ' && c <= '~') {
-		return c;
+static string makeAssembly(const string hname, const string path, const unsigned long long length) {
+	stringstream source;
+
+	// C symbols are prefixed on Mach-O & 32 bit Windows
+	source << "#if defined(__APPLE__) || (defined(_WIN32) && !defined(_WIN64))" << eol
+			<< "#define SYMBOL(name) _##name" << eol
+			<< "#else" << eol
+			<< "#define SYMBOL(name) name" << eol
+			<< "#endif" << eol << eol;
+
+	if (data_section.empty()) {
+		source << "#if defined(__APPLE__)" << eol
+				<< "\t.const" << eol
+				<< "#elif defined(_WIN32)" << eol
+				<< "\t.section .rdata,\"dr\"" << eol
+				<< "#else" << eol
+				<< "\t.section .rodata" << eol
+				<< "#endif" << eol << eol;
 	} else {
-		return '.';
+		// Mach-O names are given as "segment,section"
+		source << "#if defined(__APPLE__)" << eol
+				<< "\t.section " << data_section << eol
+				<< "#elif defined(_WIN32)" << eol
+				<< "\t.section " << data_section << ",\"dr\"" << eol
+				<< "#else" << eol
+				<< "\t.section " << data_section << ",\"a\"" << eol
+				<< "#endif" << eol << eol;
 	}
+
+	source << "\t.globl SYMBOL(" << hname << ")" << eol
+			<< "#ifdef __ELF__" << eol
+			<< "\t.type SYMBOL(" << hname << "), %object" << eol
+			<< "#endif" << eol
+			<< "\t.balign " << (data_align > 0 ? data_align : 16) << eol
+			<< "SYMBOL(" << hname << "):" << eol
+			<< "\t.incbin \"" << path << "\", " << offset << ", " << length << eol
+			<< "#ifdef __ELF__" << eol
+			<< "\t.size SYMBOL(" << hname << "), . - SYMBOL(" << hname << ")" << eol
+			<< "#endif" << eol
+			<< "\t.globl SYMBOL(" << hname << "_end)" << eol
+			<< "SYMBOL(" << hname << "_end):" << eol << eol;
+
+	source << "\t.globl SYMBOL(" << hname << "_size)" << eol
+			<< "#ifdef __ELF__" << eol
+			<< "\t.type SYMBOL(" << hname << "_size), %object" << eol
+			<< "\t.size SYMBOL(" << hname << "_size), 8" << eol
+			<< "#endif" << eol
+			<< "\t.balign 8" << eol
+			<< "SYMBOL(" << hname << "_size):" << eol
+			<< "\t.quad " << length << eol;
+
+	// mark stack as non-executable, as compiled C sources do
+	source << "#ifdef __ELF__" << eol
+			<< "\t.section .note.GNU-stack,\"\",%progbits" << eol
+			<< "#endif" << eol;
+
+	return source.str();
 }
 
 
-int convert(const string fin, string fout, string hname, const bool stdvector) {
-	if (outlen > 32 || outlen % 8 != 0) {
-		cout << "\nERROR: Unsupported pack size, must be 8, 16, or 32" << endl;
-		return -1;
-	}
+// characters replaced in names
+static const char badchars[6] = {'\\', '+', '-', '*', ' '};
 
-	const string source_basename = getBaseName(fin);
+/** Derives path of the header written for an input file.
+ *
+ *  @tparam string fin
+ *      Path to input file.
+ *  @tparam string fout
+ *      Requested path (empty = next to input file).
+ *  @return
+ *      Path with unsupported characters of the file name replaced.
+ */
+static string getTargetPath(const string fin, const string fout) {
 	string target_basename;
 	string target_dir;
 	if (checkEmptyString(fout)) {
-		target_basename = source_basename + ".h";
+		target_basename = (fin == "-" ? "stdin_data" : getBaseName(fin)) + ".h";
 		target_dir = getDirName(fin);
 	} else {
 		target_basename = getBaseName(fout);
 		target_dir = getDirName(fout);
 	}
 
-	if (checkEmptyString(hname)) {
-		// use source filename as default
-		hname = source_basename;
+	for (int current = 0; current < target_basename.length(); current++) {
+		for (int x = 0; x < len(badchars); x++) {
+			if (target_basename[current] == badchars[x])
+				target_basename.replace(current, 1, "_");
+		}
 	}
 
-	/* *** START: check characters *** */
+	return joinPath(target_dir, target_basename);
+}
+
 
-	char badchars[6] = {'\\', '+', '-', '*', ' '};
-	for (int current = 0; current < hname.length(); current++) {
+/** Replaces characters that cannot be used in identifiers.
+ *
+ *  @tparam string name
+ *      Header name.
+ *  @return
+ *      Name usable for variables & macros.
+ */
+static string makeIdentifier(string name) {
+	for (int current = 0; current < name.length(); current++) {
 		for (int x = 0; x < len(badchars); x++) {
-			if ((hname[current] == badchars[x]) || (hname[current] == '.'))
-				hname.replace(current, 1, "_");
+			if ((name[current] == badchars[x]) || (name[current] == '.'))
+				name.replace(current, 1, "_");
 		}
 	}
-	for (int current = 0; current < target_basename.length(); current++) {
-		for (int x = 0; x < len(badchars); x++) {
-			if (target_basename[current] == badchars[x])
-				target_basename.replace(current, 1, "_");
+
+	// add '_' when first char is a number
+	if (isdigit(name[0])) {
+		name.insert(0, 1, '_');
+	}
+
+	return name;
+}
+
+/** Creates name of the include guard macro from a header name. */
+static string makeGuard(const string name) {
+	string guard = name;
+	for (size_t current = 0; current < guard.length(); current++) {
+		guard[current] = toupper(guard[current]);
+	}
+
+	return guard + "_H";
+}
+
+
+// changed when the output for the same input & options changes, so that
+// fingerprints of earlier output no longer match
+static const string fingerprint_revision = "1";
+
+/** Adds a range of the input to a fingerprint.
+ *
+ *  @return
+ *      `false` if the range could not be read.
+ */
+static bool hashInput(InputFile& ifs, const unsigned long long start, const unsigned long long count,
+		Hash64& hash) {
+	if (!ifs.select(start, count)) {
+		return false;
+	}
+
+	const size_t block_size = 1024 * 1024;
+	vector<char> buffer(ifs.isMapped() ? 0 : block_size);
+	for (unsigned long long done = 0; done < count;) {
+		const size_t size = (size_t) min(count - done, (unsigned long long) block_size);
+		const unsigned char* data = ifs.read(buffer.data(), size);
+		if (data == NULL) {
+			return false;
 		}
+
+		hash.update(data, size);
+		ifs.release(data + size);
+		done += size;
 	}
 
-	fout = joinPath(target_dir, target_basename);
+	return true;
+}
 
-	// add '_' when first char is a number
-	if (isdigit(hname[0]))
-	{
-		hname.insert(0, 1, '_');
+/** Checks if a file starts with a fingerprint line, reading only that line. */
+static bool hasFingerprint(const string path, const string line) {
+	ifstream ifs(path.c_str(), ios::binary);
+	if (!ifs.is_open()) {
+		return false;
 	}
 
-	/* *** END: check characters *** */
+	string text(line.length(), '\0');
+	ifs.read(&text[0], text.length());
+	return ifs.gcount() == (streamsize) text.length() && text == line;
+}
 
-	/* *** START: uppercase header name *** */
 
-	char hname_upper[hname.length() + 2];
-	for (int current = 0; current < len(hname_upper); current++) {
-		hname_upper[current] = hname[current];
-		hname_upper[current] = toupper(hname_upper[current]);
+/** Reads data from input & writes header (see `convert`).
+ *
+ *  Options are only read, so that files can be converted concurrently.
+ *
+ *  @tparam int format_jobs
+ *      Number of threads formatting chunks.
+ *  @tparam ostream msg
+ *      Stream for messages & progress.
+ *  @tparam long long bytes_written
+ *      Set to number of data bytes written.
+ *  @tparam long long data_size
+ *      Set to number of data bytes referred to by the header (also if
+ *      not written, e.g. included by the compiler or unchanged).
+ */
+static int convertFile(const string fin, string fout, string hname, const bool stdvector,
+		const unsigned int format_jobs, ostream& msg, unsigned long long& bytes_written,
+		unsigned long long& data_size) {
+	// reading from standard input writes to standard output unless a file is given
+	const bool to_stdout = fout == "-" || (checkEmptyString(fout) && fin == "-");
+
+	// keep messages out of the generated header
+	const StdoutRedirect redirect(to_stdout);
+
+	bytes_written = 0;
+	data_size = 0;
+
+	// adjusted to the data below without changing the options
+	unsigned int nb_data = nbData;
+	unsigned int chunk_bytes = chunk_size;
+	unsigned long long shard_limit = shard_size;
+
+	if (outlen != 8 && outlen != 16 && outlen != 32 && outlen != 64) {
+		msg << "\nERROR: Unsupported pack size, must be 8, 16, 32, or 64" << endl;
+		return -1;
 	}
 
-	string name_upper_h = hname_upper;
-	name_upper_h.append("_H");
+	const bool literal = outformat == "string";
+	if (literal && outlen != 8) {
+		msg << "\nERROR: String format only supports 8 bit data" << endl;
+		return -1;
+	}
 
-	/* *** END: uppercase header name *** */
+	// data included from the input file by the compiler or assembler, or
+	// copied to an object file declared by the header
+	const bool embed = outformat == "embed";
+	const bool incbin = outformat == "incbin";
+	const bool elf = outformat == "elf64" || outformat == "elf32";
+	const string format_title = embed ? "Embed" : incbin ? "Incbin" : "ELF";
+	if ((embed || incbin || elf) && outlen != 8) {
+		msg << "\nERROR: " << format_title << " format only supports 8 bit data" << endl;
+		return -1;
+	} else if ((embed || incbin || elf) && fin == "-") {
+		msg << "\nERROR: " << format_title << " format requires an input file" << endl;
+		return -1;
+	} else if ((incbin || elf) && to_stdout) {
+		msg << "\nERROR: " << format_title << " format requires an output file" << endl;
+		return -1;
+	} else if (split && (embed || incbin || elf)) {
+		msg << "\nERROR: " << format_title << " format cannot be split" << endl;
+		return -1;
+	} else if (split && to_stdout) {
+		msg << "\nERROR: Split output requires an output file" << endl;
+		return -1;
+	}
+
+	// shards are defined in separate sources like split output, but are not contiguous
+	const bool sharded = shard_limit > 0;
+	if (sharded && (embed || incbin || elf)) {
+		msg << "\nERROR: " << format_title << " format cannot be sharded" << endl;
+		return -1;
+	} else if (sharded && to_stdout) {
+		msg << "\nERROR: Sharded output requires an output file" << endl;
+		return -1;
+	} else if (sharded && (stdvector || dataview != "none")) {
+		msg << "\nERROR: Sharded output cannot be stored in std::vector or views" << endl;
+		return -1;
+	} else if (sharded && shard_limit < outlen / 8) {
+		msg << "\nERROR: Shard size must be at least one data word" << endl;
+		return -1;
+	}
+
+	// "stdin" alone would clash with the stdio macro
+	const string source_basename = fin == "-" ? "stdin_data" : getBaseName(fin);
+	if (checkEmptyString(hname)) {
+		// use source filename as default
+		hname = source_basename;
+	}
+
+	hname = makeIdentifier(hname);
+	fout = to_stdout ? "-" : getTargetPath(fin, fout);
+	const string name_upper_h = makeGuard(hname);
+
+	// #embed resolves paths relative to the including header, .incbin relative
+	// to the working directory of the assembler
+	string embed_path;
+	if (embed || incbin) {
+		embed_path = to_stdout || incbin ? getAbsolutePath(fin) : getRelativePath(fin, getDirName(fout));
+		if (checkEmptyString(embed_path)) {
+			msg << "ERROR: could not resolve path to input file" << endl;
+			return EIO;
+		}
+		if (embed_path.find('"') != string::npos || embed_path.find('\n') != string::npos) {
+			msg << "ERROR: input file path cannot be used with " << (embed ? "#embed" : ".incbin") << endl;
+			return EINVAL;
+		}
+		embed_path = replaceAll(embed_path, "\\", "/");
+	}
+
+	// assembler source, object or data sources are written next to the header
+	string fout_base = fout;
+	if (fout_base.length() > 2 && fout_base.substr(fout_base.length() - 2) == ".h") {
+		fout_base.erase(fout_base.length() - 2);
+	}
+
+	string fout_data;
+	if (incbin) fout_data = fout_base + ".S";
+	else if (elf) fout_data = fout_base + ".o";
+	else if (split || sharded) fout_data = fout_base + (stdvector ? ".cpp" : ".c");
 
 	// set signal interrupt (Ctrl+C) handler
 	signal(SIGINT, sigintHandler);
@@ -142,181 +477,660 @@ int convert(const string fin, string fout, string hname, const bool stdvector) {
 	/* *** START: read/write *** */
 
 	// file streams
-	ifstream ifs;
-	ofstream ofs;
-	unsigned long long bytes_written = 0;
+	InputFile ifs;
+	OutputFile ofs;
 
 	const long long starttime = currentTimeMillis();
 
 	try {
-		ifs.open(fin.c_str(), ifstream::binary);
+		if (!ifs.open(fin)) {
+			msg << "ERROR: could not open file for reading" << endl;
+			return EIO;
+		}
 
-		unsigned long long data_length;
+		const unsigned long long data_length = ifs.size();
 		unsigned char wordbytes = outlen / 8;
-		ifs.seekg(0, ifstream::end);
-		data_length = ifs.tellg();
-		ifs.seekg(0, ifstream::beg);
 
-		if (offset > data_length) {
-			cout << "ERROR: offset bigger than file length" << endl;
+		if ((embed || incbin || elf) && !ifs.hasSize()) {
+			msg << "ERROR: " << format_title << " format requires a regular input file" << endl;
+			return EINVAL;
+		}
+
+		if (ifs.hasSize() && offset > data_length) {
+			msg << "ERROR: offset bigger than file length" << endl;
+			return -1;
+		}
+
+		if (nb_data == 0) {
+			msg << "ERROR: number of bytes per line must be greater than 0" << endl;
 			return -1;
 		}
 
-		unsigned long long chunk_count = ceil((double) (data_length - offset) / chunk_size);
+		// keeps source lines short; adjacent literals are concatenated, so the
+		// length limits of compilers apply to the whole data & are not avoided
+		if (literal && nb_data > 4095) {
+			msg << "Warning: Bytes per line limited to 4095 for string literals" << endl;
+			nb_data = 4095;
+		}
 
-		if (chunk_size % wordbytes) {
-			cout << "Warning: Chunk size truncated to full words length" << endl;
-			chunk_size -= chunk_size % wordbytes;
+		if (chunk_bytes % wordbytes) {
+			msg << "Warning: Chunk size truncated to full words length" << endl;
+			chunk_bytes -= chunk_bytes % wordbytes;
 		}
 
-		cout << "File size:  " << to_string(data_length) << " bytes" << endl;
-		cout << "Chunk size: " << to_string(chunk_size) << " bytes" << endl;
+		if (shard_limit % wordbytes) {
+			msg << "Warning: Shard size truncated to full words length" << endl;
+			shard_limit -= shard_limit % wordbytes;
+		}
 
-		if (offset) cout << "Start from position: " << to_string(offset) << endl;
-		if (length) cout << "Process maximum " << to_string(length) << " bytes" << endl;
-		if (outlen != 8) cout << "Pack into " << to_string(outlen) << " bit ints" << endl;
-		if (outlen > 8 && swap_bytes) cout << "Swap endianess" << endl;
+		if (sharded && !ifs.hasSize()) {
+			msg << "ERROR: Sharded output requires a regular input file" << endl;
+			return EINVAL;
+		}
 
-		ofs.open(fout.c_str(), ofstream::binary);
-		ofs << "#ifndef " << name_upper_h.c_str() << eol << "#define " << name_upper_h.c_str() << eol;
-		if (stdvector) {
-			ofs << eol << "#ifdef __cplusplus" << eol << "#include <vector>" << eol << "#endif" << eol;
+		// chunks are read in whole lines so each can be formatted independently
+		const LineFormat fmt = {wordbytes, nb_data, swap_bytes, showDataContent && !literal, eol, literal};
+		const unsigned int line_bytes = fmt.lineBytes();
+		unsigned int read_size = line_bytes;
+		if (chunk_bytes > line_bytes) {
+			read_size = chunk_bytes - chunk_bytes % line_bytes;
 		}
 
-		if (outlen == 32) ofs << eol << "static const unsigned int " << hname << "[] = {" << eol;
-		else if (outlen == 16) ofs << eol << "static const unsigned short " << hname << "[] = {" << eol;
-		else ofs << eol << "static const unsigned char " << hname << "[] = {" << eol;
+		if (ifs.hasSize()) msg << "File size:  " << to_string(data_length) << " bytes" << endl;
+		else msg << "File size:  unknown (stream)" << endl;
+		msg << "Chunk size: " << to_string(read_size) << " bytes" << endl;
+
+		if (offset) msg << "Start from position: " << to_string(offset) << endl;
+		if (length) msg << "Process maximum " << to_string(length) << " bytes" << endl;
+		if (outlen != 8) msg << "Pack into " << to_string(outlen) << " bit ints" << endl;
+		if (outlen > 8 && swap_bytes) msg << "Swap endianess" << endl;
+		if (format_jobs > 1) msg << "Format with " << to_string(format_jobs) << " threads" << endl;
+		if (literal) msg << "Write string literals" << endl;
+		if (embed) msg << "Embed \"" << embed_path << "\"" << endl;
+		if (embed && embed_fallback) msg << "Write array for compilers without #embed" << endl;
+		if (incbin) msg << "Include \"" << embed_path << "\" from " << fout_data << endl;
+		if (elf) msg << "Copy to " << outformat.substr(3) << " bit ELF object " << fout_data << endl;
+		if (split) msg << "Define data in " << fout_data << endl;
+		if (sharded) msg << "Define data in sources of " << to_string(shard_limit) << " bytes" << endl;
 
 		// empty line
-		cout << endl;
+		msg << endl;
 
-		// how many bytes to write
-		unsigned long long bytes_to_go = data_length - offset;
-		if (length > 0 && length < bytes_to_go) bytes_to_go = length;
+		// how many bytes to write (unknown for streams)
+		unsigned long long bytes_to_go = 0;
+		if (ifs.hasSize()) {
+			bytes_to_go = data_length - offset;
+			if (length > 0 && length < bytes_to_go) bytes_to_go = length;
 
-		// check if there are any bytes to omit during packing
-		// FIXME: incomplete words not processed
-		int omit = bytes_to_go % (outlen / 8);
-		if (omit) {
-			cout << "Warning: Last " << to_string(omit) << " byte(s) will be ignored as not forming full data word" << endl;
-			bytes_to_go -= omit;
+			// check if there are any bytes to omit during packing
+			// FIXME: incomplete words not processed
+			int omit = bytes_to_go % (outlen / 8);
+			if (omit) {
+				msg << "Warning: Last " << to_string(omit) << " byte(s) will be ignored as not forming full data word" << endl;
+				bytes_to_go -= omit;
+			}
 		}
 
-		bool eof = false; // to check if we are at the end of file
-		std::string comment = "";
-		unsigned long long chunk_idx;
-		for (chunk_idx = 0; chunk_idx < chunk_count; chunk_idx++) {
-			if (eof || cancelled) {
-				break;
+		data_size = bytes_to_go;
+
+		// without a fallback, the data is only read by the compiler or assembler
+		const unsigned long long read_bytes = (embed && !embed_fallback) || incbin ? 0 : bytes_to_go;
+
+		// outputs referring to the input file hold no data worth caching
+		const bool cached = !cache_dir.empty() && !embed && !incbin;
+
+		// data read & all options affecting the output, written to the first line of the header
+		string fingerprint;
+		string fingerprint_pending;
+		string cache_key;
+		if ((skip_unchanged || cached) && ifs.hasSize() && !to_stdout) {
+			stringstream options;
+			options << fingerprint_revision << eol << hname << eol << stdvector << eol << outlen << eol
+					<< nb_data << eol << showDataContent << eol << swap_bytes << eol << offset << eol
+					<< bytes_to_go << eol << outformat << eol << embed_fallback << eol << embed_path << eol
+					<< split << eol << dataview << eol << shard_limit << eol << data_align << eol
+					<< data_section << eol;
+
+			Hash64 hash;
+			hash.update(options.str());
+			if (!hashInput(ifs, offset, read_bytes, hash)) {
+				msg << "ERROR: could not read input file" << endl;
+				ifs.close();
+				return EIO;
 			}
 
-			cout << "\rWriting chunk " << to_string(chunk_idx + 1) << " out of " << to_string(chunk_count) << " (Ctrl+C to cancel)" << std::flush;
+			stringstream digest;
+			digest << hex << setw(16) << setfill('0') << hash.digest();
+			if (skip_unchanged) {
+				fingerprint = "/* bin2header fingerprint: " + digest.str() + " */" + eol;
+
+				// written in its place until all outputs are complete, so that interrupted runs never match
+				fingerprint_pending = "/* bin2header fingerprint: " + string(digest.str().length(), '-') + " */" + eol;
+			}
+
+			// sources of split & sharded data also name the header they include
+			if (cached) {
+				Hash64 key;
+				key.update(cache_version + eol + digest.str() + eol + (split || sharded ? getBaseName(fout) : "")
+						+ eol + to_string(skip_unchanged));
+				stringstream key_text;
+				key_text << hex << setw(16) << setfill('0') << key.digest();
+				cache_key = key_text.str();
+			}
+		}
+
+		// offsets are a vendor extension, so each known spelling is tried in turn
+		vector<string> embed_params;
+		if (embed) {
+			const string limit = length > 0 ? " limit(" + to_string(bytes_to_go) + ")" : "";
+			if (offset > 0) {
+				embed_params.push_back(" gnu::offset(" + to_string(offset) + ")" + limit);
+				embed_params.push_back(" clang::offset(" + to_string(offset) + ")" + limit);
+			} else {
+				embed_params.push_back(limit);
+			}
+		}
+		const string macro_prefix = name_upper_h.substr(0, name_upper_h.length() - 2);
+		const string embed_macro = macro_prefix + "_EMBED";
+
+		string data_type = "unsigned char";
+		if (outlen == 64) data_type = "unsigned long long";
+		else if (outlen == 32) data_type = "unsigned int";
+		else if (outlen == 16) data_type = "unsigned short";
+
+		// data defined in a separate source has external linkage
+		const string storage = split ? "" : "static ";
+
+		// vectors hold the bytes of packed data
+		const string vector_begin = outlen == 8 ? hname : "(const unsigned char*) " + hname;
+
+		// language version providing the view type
+		string view_cplusplus;
+		if (dataview == "span") view_cplusplus = "202002L";
+		else if (dataview == "string_view") view_cplusplus = "201703L";
+
+		// alignment & section are set by macros, as compilers spell them differently
+		const string align_macro = macro_prefix + "_ALIGN";
+		const string section_macro = macro_prefix + "_SECTION";
+		string placement;
+		if (data_align > 0) placement += align_macro + " ";
+		if (!data_section.empty()) placement += section_macro + " ";
+
+		const auto makePlacement = [&]() {
+			stringstream macros;
+			if (data_align > 0) {
+				const string align = to_string(data_align);
+				macros << eol << "#if defined(__cplusplus) && __cplusplus >= 201103L" << eol
+						<< "#define " << align_macro << " alignas(" << align << ")" << eol
+						<< "#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L" << eol
+						<< "#define " << align_macro << " _Alignas(" << align << ")" << eol
+						<< "#elif defined(_MSC_VER)" << eol
+						<< "#define " << align_macro << " __declspec(align(" << align << "))" << eol
+						<< "#else" << eol
+						<< "#define " << align_macro << " __attribute__((aligned(" << align << ")))" << eol
+						<< "#endif" << eol;
+			}
+			if (!data_section.empty()) {
+				macros << eol << "#ifdef _MSC_VER" << eol
+						<< "#pragma section(\"" << data_section << "\", read)" << eol
+						<< "#define " << section_macro << " __declspec(allocate(\"" << data_section << "\"))" << eol
+						<< "#else" << eol
+						<< "#define " << section_macro << " __attribute__((section(\"" << data_section << "\")))" << eol
+						<< "#endif" << eol;
+			}
+
+			return macros.str();
+		};
+
+		const auto makeIncludes = [&]() {
+			stringstream includes;
+			if (stdvector) {
+				includes << eol << "#ifdef __cplusplus" << eol << "#include <vector>" << eol << "#endif" << eol;
+			}
+			if (!view_cplusplus.empty()) {
+				includes << eol << "#if defined(__cplusplus) && __cplusplus >= " << view_cplusplus << eol
+						<< "#include <" << dataview << ">" << eol << "#endif" << eol;
+			}
 
-			char chunk[chunk_size];
-			ifs.seekg(chunk_idx * chunk_size + offset);
-			ifs.read(chunk, chunk_size);
+			return includes.str();
+		};
 
-			unsigned int byte_idx;
-			for (byte_idx = 0; byte_idx < chunk_size; byte_idx++) {
-				if (eof || cancelled) {
-					break;
+		// views refer to the data without copying it
+		const auto makeView = [&](const unsigned long long count) {
+			// string literals have a terminating NUL in C++
+			const string bytes = literal ? to_string(count) : "sizeof(" + hname + ")";
+			const string elements = literal ? bytes : bytes + " / sizeof(" + hname + "[0])";
+
+			stringstream view;
+			if (dataview == "span") {
+				view << eol << "#if defined(__cplusplus) && __cplusplus >= " << view_cplusplus << eol
+						<< "constexpr std::span<const " << data_type << "> " << hname << "_span(" << hname << ", "
+						<< elements << ");" << eol << "#endif" << eol;
+			} else if (dataview == "string_view") {
+				// casting the array prevents constexpr, but no copy is made
+				view << eol << "#if defined(__cplusplus) && __cplusplus >= " << view_cplusplus << eol
+						<< "static const std::string_view " << hname << "_sv(reinterpret_cast<const char*>("
+						<< hname << "), " << bytes << ");" << eol << "#endif" << eol;
+			} else if (dataview == "struct") {
+				// shared by all headers
+				view << eol << "#ifndef B2H_VIEW_DEFINED" << eol << "#define B2H_VIEW_DEFINED" << eol
+						<< "typedef struct b2h_view {" << eol
+						<< "\tconst unsigned char* data;" << eol
+						<< "\tunsigned long long size;" << eol
+						<< "} b2h_view;" << eol << "#endif" << eol
+						<< "static const b2h_view " << hname << "_view = { " << vector_begin << ", " << bytes << " };"
+						<< eol;
+			}
+
+			return view.str();
+		};
+
+		stringstream header;
+		if (!(incbin || elf || split || sharded)) {
+			header << fingerprint_pending;
+		}
+		if (split) {
+			header << "#include \"" << getBaseName(fout) << "\"" << eol;
+		} else {
+			header << "#ifndef " << name_upper_h.c_str() << eol << "#define " << name_upper_h.c_str() << eol;
+			header << makeIncludes();
+			header << makePlacement();
+		}
+
+		if (embed) {
+			// defined to the index of the supported parameters
+			header << eol << "#ifdef __has_embed" << eol;
+			for (size_t idx = 0; idx < embed_params.size(); idx++) {
+				header << (idx == 0 ? "#if" : "#elif") << " __has_embed(\"" << embed_path << "\""
+						<< embed_params[idx] << ")" << eol << "#define " << embed_macro << " " << idx + 1 << eol;
+			}
+			header << "#endif" << eol << "#endif" << eol;
+		}
+
+		if (literal && ifs.hasSize() && bytes_to_go > 0) {
+			// C++ requires room for the terminating NUL of the literal
+			header << eol << "#ifdef __cplusplus" << eol
+					<< placement << storage << "const unsigned char " << hname << "[" << bytes_to_go << " + 1] =" << eol
+					<< "#else" << eol
+					<< placement << storage << "const unsigned char " << hname << "[" << bytes_to_go << "] =" << eol
+					<< "#endif" << eol;
+		} else if (literal) {
+			header << eol << placement << storage << "const unsigned char " << hname << "[] =" << eol;
+		} else {
+			header << eol << placement << storage << "const " << data_type << " " << hname << "[] = {" << eol;
+		}
+
+		if (embed) {
+			header << "#ifndef " << embed_macro << eol;
+			if (!embed_fallback) header << "#error \"#embed is not supported by this compiler\"" << eol;
+		}
+
+		const auto makeClosing = [&](const unsigned long long count) {
+			stringstream closing;
+			if (literal) {
+				// an empty literal keeps the initializer valid
+				if (count == 0) closing << "\t\"\"" << eol;
+				closing << ";" << eol;
+			} else {
+				for (size_t idx = 0; embed && idx < embed_params.size(); idx++) {
+					if (idx + 1 < embed_params.size()) closing << "#elif " << embed_macro << " == " << idx + 1 << eol;
+					else closing << "#else" << eol;
+					closing << "#embed \"" << embed_path << "\"" << embed_params[idx] << eol;
 				}
+				if (embed) closing << "#endif" << eol;
+				closing << "};" << eol;
+			}
+
+			return closing.str();
+		};
 
-				if ((bytes_written % (nbData * wordbytes)) == 0) {
-					ofs << "\t";
-					comment = "";
+		// string literals are followed by their length, which streams only know at the end
+		const auto makeFooter = [&](const unsigned long long count) {
+			stringstream footer;
+			footer << makeClosing(count);
+			if (literal || split) {
+				footer << eol << storage << "const unsigned long long " << hname << "_size = " << count << ";" << eol;
+			}
+
+			if (split) {
+				// defined once for all sources including the header
+				if (stdvector) {
+					footer << eol << "const std::vector<unsigned char> " << hname << "_v(" << vector_begin << ", "
+							<< vector_begin << " + " << hname << "_size);" << eol;
 				}
+				return footer.str();
+			}
 
-				stringstream ss;
-				unsigned int word;
-				if (wordbytes == 2) {
-					// pack input bytes into 16 bit ints
-					if (swap_bytes) {
-						word = (unsigned char) chunk[byte_idx++];
-						word += (unsigned char) chunk[byte_idx] << 8;
-					} else {
-						word = (unsigned char) chunk[byte_idx++] << 8;
-						word += (unsigned char) chunk[byte_idx];
-					}
-					ss << "0x" << hex << setw(4) << setfill('0') << (short) word;
-				} else if (wordbytes == 4) {
-					// pack input bytes into 32 bit words
-					if (swap_bytes) {
-						word = (unsigned char) chunk[byte_idx++];
-						word += (unsigned char) chunk[byte_idx++] << 8;
-						word += (unsigned char) chunk[byte_idx++] << 16;
-						word += (unsigned char) chunk[byte_idx] << 24;
-					} else {
-						word = (unsigned char) chunk[byte_idx++] << 24;
-						word += (unsigned char) chunk[byte_idx++] << 16;
-						word += (unsigned char) chunk[byte_idx++] << 8;
-						word += (unsigned char) chunk[byte_idx];
-					}
-					ss << "0x" << hex << setw(8) << setfill('0') << (int) word;
-				} else {
-					// pack single bytes
-					ss << "0x" << hex << setw(2) << setfill('0') << (int)(unsigned char) chunk[byte_idx];
+			if (stdvector) {
+				footer << eol << "#ifdef __cplusplus" << eol << "static const std::vector<unsigned char> "
+						<< hname << "_v(" << vector_begin << ", " << vector_begin << " + "
+						<< (literal ? hname + "_size" : "sizeof(" + hname + ")") << ");" << eol << "#endif" << eol;
+			}
+			footer << makeView(count);
+			footer << eol << "#endif /* " << name_upper_h << " */" << eol;
+
+			return footer.str();
+		};
+
+		// data is written to a single file, or to one source per shard
+		const unsigned long long shard_length = sharded ? shard_limit : read_bytes;
+		const unsigned long long shard_count = sharded && read_bytes > 0
+				? (read_bytes + shard_limit - 1) / shard_limit : 1;
+		const auto shardBytes = [&](const unsigned long long shard) {
+			return min(shard_length, read_bytes - shard * shard_length);
+		};
+
+		const auto shardPath = [&](const unsigned long long shard) {
+			return fout_base + "." + to_string(shard) + ".c";
+		};
+
+		const auto makeShardHead = [&](const unsigned long long shard) {
+			stringstream head;
+			head << "#include \"" << getBaseName(fout) << "\"" << eol << eol;
+			if (literal) head << placement << "const unsigned char " << hname << "_" << shard << "[] =" << eol;
+			else head << placement << "const " << data_type << " " << hname << "_" << shard << "[] = {" << eol;
+
+			return head.str();
+		};
+
+		// source listing the shards in order
+		const auto makeShardIndex = [&](const unsigned long long count) {
+			stringstream index;
+			index << "#include \"" << getBaseName(fout) << "\"" << eol << eol
+					<< "const unsigned char* const " << hname << "_shards[" << shard_count << "] = {" << eol;
+			for (unsigned long long shard = 0; shard < shard_count; shard++) {
+				index << "\t" << (outlen == 8 ? "" : "(const unsigned char*) ") << hname << "_" << shard
+						<< (shard + 1 < shard_count ? "," : "") << eol;
+			}
+			index << "};" << eol << eol
+					<< "const unsigned long long " << hname << "_size = " << count << ";" << eol;
+
+			return index.str();
+		};
+
+		// header declaring data defined elsewhere
+		const auto makeDeclarations = [&](const unsigned long long count) {
+			stringstream decl;
+			decl << fingerprint_pending;
+			decl << "#ifndef " << name_upper_h << eol << "#define " << name_upper_h << eol;
+			decl << makeIncludes();
+			if (!incbin && !elf) decl << makePlacement();
+
+			if (sharded) {
+				decl << eol << "#include <string.h>" << eol;
+			}
+
+			decl << eol << "#ifdef __cplusplus" << eol << "extern \"C\" {" << eol << "#endif" << eol;
+			if (sharded) {
+				for (unsigned long long shard = 0; shard < shard_count; shard++) {
+					decl << "extern const " << data_type << " " << hname << "_" << shard << "[];" << eol;
 				}
-				ofs << ss.str();
-				if (showDataContent) {
-					comment += toPrintableChar(chunk[byte_idx]);
+				decl << "extern const unsigned char* const " << hname << "_shards[" << shard_count << "];" << eol;
+			} else if (literal && count > 0) {
+				decl << "#ifdef __cplusplus" << eol
+						<< "extern const unsigned char " << hname << "[" << count << " + 1];" << eol
+						<< "#else" << eol
+						<< "extern const unsigned char " << hname << "[" << count << "];" << eol
+						<< "#endif" << eol;
+			} else {
+				decl << "extern const " << data_type << " " << hname << "["
+						<< (count > 0 ? to_string(count / wordbytes) : "") << "];" << eol;
+			}
+			if (incbin || elf) decl << "extern const unsigned char " << hname << "_end[];" << eol;
+			decl << "extern const unsigned long long " << hname << "_size;" << eol
+					<< "#ifdef __cplusplus" << eol << "}" << eol << "#endif" << eol;
+
+			if (stdvector) {
+				decl << eol << "#ifdef __cplusplus" << eol;
+				if (split) decl << "extern const std::vector<unsigned char> " << hname << "_v;" << eol;
+				else decl << "static const std::vector<unsigned char> " << hname << "_v(" << hname << ", "
+						<< hname << " + sizeof(" << hname << "));" << eol;
+				decl << "#endif" << eol;
+			}
+			decl << makeView(count);
+
+			if (sharded) {
+				const string shard_bytes = to_string(shard_length);
+				decl << eol << "/* shards of " << shard_bytes << " bytes accessed as one buffer */" << eol
+						<< "static inline unsigned char " << hname << "_at(const unsigned long long pos) {" << eol
+						<< "\treturn " << hname << "_shards[pos / " << shard_bytes << "][pos % " << shard_bytes << "];" << eol
+						<< "}" << eol << eol
+						<< "static inline void " << hname << "_copy(void* dest, unsigned long long pos, unsigned long long count) {" << eol
+						<< "\tunsigned char* out = (unsigned char*) dest;" << eol
+						<< "\twhile (count > 0) {" << eol
+						<< "\t\tunsigned long long part = " << shard_bytes << " - pos % " << shard_bytes << ";" << eol
+						<< "\t\tif (part > count) part = count;" << eol
+						<< "\t\tmemcpy(out, " << hname << "_shards[pos / " << shard_bytes << "] + pos % " << shard_bytes
+						<< ", (size_t) part);" << eol
+						<< "\t\tout += part;" << eol
+						<< "\t\tpos += part;" << eol
+						<< "\t\tcount -= part;" << eol
+						<< "\t}" << eol
+						<< "}" << eol;
+			}
+			decl << eol << "#endif /* " << name_upper_h << " */" << eol;
+
+			return decl.str();
+		};
+
+		// all outputs are kept if the header was written from the same data & options
+		if (!fingerprint.empty() && hasFingerprint(fout, fingerprint)) {
+			bool complete = fout_data.empty() || access(fout_data.c_str(), F_OK) == 0;
+			for (unsigned long long shard = 0; sharded && complete && shard < shard_count; shard++) {
+				complete = access(shardPath(shard).c_str(), F_OK) == 0;
+			}
+
+			if (complete) {
+				ifs.close();
+				msg << "Unchanged:     " << fout << endl;
+				return 0;
+			}
+		}
+
+		// all outputs in the order they are cached
+		vector<string> outputs(1, fout);
+		if (!fout_data.empty()) outputs.push_back(fout_data);
+		for (unsigned long long shard = 0; sharded && shard < shard_count; shard++) {
+			outputs.push_back(shardPath(shard));
+		}
+
+		if (!cache_key.empty() && cacheFetch(cache_dir, cache_key, outputs)) {
+			ifs.close();
+			msg << "From cache:    " << fout << endl;
+			return 0;
+		}
+
+		// objects hold the data itself & are written instead of the header
+		const ElfObject object(outformat == "elf32" ? 32 : 64, hname, bytes_to_go, data_align, data_section);
+		if (elf && !object.isSupported()) {
+			msg << "ERROR: " << outformat << " objects not supported on this architecture or data too large" << endl;
+			ifs.close();
+			return EINVAL;
+		}
+
+
+		unsigned long long chunk_count = 0;
+		for (unsigned long long shard = 0; shard < shard_count; shard++) {
+			chunk_count += ceil((double) shardBytes(shard) / read_size);
+		}
+		unsigned long long chunk_idx = 0;
+
+		// writes a range of the input as formatted text (or a copy for objects) between head & tail
+		const auto writeData = [&](const string path, const string head, const unsigned long long start,
+				const unsigned long long count, const bool shard) {
+			// array lines have a fixed length, so the final size is known before writing
+			const string tail = elf ? object.tail() : incbin ? "" : shard ? makeClosing(count) : makeFooter(count);
+			const unsigned long long output_size = elf ? object.fileSize() : head.length()
+					+ (fmt.fixedSize() ? formattedSize(count, fmt, true) : 0)
+					+ tail.length();
+
+			// chunks of memory mapped files are formatted directly from the mapping
+			if (!ifs.select(start, count)) {
+				msg << "ERROR: offset bigger than file length" << endl;
+				return -1;
+			}
+
+			int read_error;
+			size_t omitted;
+			unsigned long long count_written = 0;
+			{
+				// streamed input is read on a background thread while chunks are formatted
+				ChunkReader reader(ifs, wordbytes, read_size, ifs.hasSize() ? count : length,
+						readahead, ChunkPipeline::capacity(format_jobs), huge_pages);
+				if (reader.error() == ENOMEM) {
+					msg << "ERROR: could not allocate read buffers of " << to_string(read_size) << " bytes" << endl;
+					return ENOMEM;
 				}
-				bytes_written += wordbytes;
-
-				if (bytes_written >= bytes_to_go) {
-					eof = true;
-					if (showDataContent) {
-						for (int i = (bytes_written % (nbData * wordbytes)); i < (nbData * wordbytes); i++) {
-							ofs << "      ";
-						}
-						ofs << "  /* " << comment << " */";
-					}
-					ofs << eol;
-				} else {
-					if ((bytes_written % (nbData * wordbytes)) == 0) {
-						ofs << ",";
-						if (showDataContent) {
-							ofs << " /* " << comment << " */";
-						}
-						ofs << eol;
+
+				if (!ofs.open(path)) {
+					msg << "ERROR: could not open file for writing" << endl;
+					return EIO;
+				}
+
+				const int reserve_error = ofs.reserve(output_size);
+				if (reserve_error == ENOSPC) {
+					msg << "ERROR: not enough disk space to write " << to_string(output_size) << " bytes" << endl;
+					return reserve_error;
+				} else if (reserve_error) {
+					msg << "ERROR: could not allocate " << to_string(output_size) << " bytes for output" << endl;
+					return reserve_error;
+				}
+
+				ofs.write(head);
+
+				// formatted text is collected per chunk & written in a single call
+				ChunkPipeline pipeline(ofs, reader, fmt, elf ? 1 : format_jobs);
+
+				ChunkReader::Chunk chunk;
+				for (; !cancelled && !ofs.error() && reader.next(chunk); chunk_idx++) {
+					msg << "\rWriting chunk " << to_string(chunk_idx + 1);
+					if (ifs.hasSize()) msg << " out of " << to_string(chunk_count);
+					msg << " (Ctrl+C to cancel)" << std::flush;
+
+					if (elf) {
+						// objects hold a plain copy of the data
+						ofs.write((const char*) chunk.data, chunk.size);
+						reader.release(chunk);
 					} else {
-						ofs << ", ";
+						pipeline.submit(chunk);
 					}
+					count_written += chunk.size;
 				}
-			}	/* for (byte_idx...) */
+				pipeline.finish();
+
+				read_error = reader.error();
+				omitted = reader.omitted();
+			}
+			bytes_written += count_written;
+
+			if (read_error) {
+				if (read_error == ENOMEM) msg << "\nERROR: out of read buffers" << endl;
+				else msg << "\nERROR: unexpected end of file" << endl;
+				ofs.close();
+				return read_error;
+			}
+
+			if (omitted) {
+				msg << "\nWarning: Last " << to_string(omitted) << " byte(s) ignored as not forming full data word" << endl;
+			}
+
+			if (cancelled) {
+				// close write stream & exit
+				ofs.close();
+				return ECANCELED;
+			}
+
+			ofs.write(elf || incbin || shard ? tail : makeFooter(count_written));
+
+			const int write_error = ofs.error();
+			ofs.close();
+			if (write_error) {
+				msg << "\nERROR: could not write output file. Code: " << write_error << endl;
+			}
+
+			return write_error;
+		};
+
+		// a header written last would otherwise vouch for partly rewritten outputs
+		if (!fingerprint.empty() && (incbin || elf || split || sharded)) {
+			remove(fout.c_str());
 		}
 
+		for (unsigned long long shard = 0; shard < shard_count; shard++) {
+			int data_error;
+			if (!sharded) {
+				const string fout_main = incbin || elf || split ? fout_data : fout;
+				const string text_head = elf ? object.head()
+						: incbin ? makeAssembly(hname, embed_path, bytes_to_go) : header.str();
+				data_error = writeData(fout_main, text_head, offset, read_bytes, false);
+			} else {
+				data_error = writeData(shardPath(shard), makeShardHead(shard), offset + shard * shard_length,
+						shardBytes(shard), true);
+			}
+
+			if (data_error) {
+				ifs.close();
+				return data_error;
+			}
+		}
+
+		// size of streams is known once read
+		if (!ifs.hasSize()) data_size = bytes_written;
+
 		// release input file after read
 		ifs.close();
-		if (cancelled) {
-			// close write stream & exit
-			ofs.close();
-			return ECANCELED;
-		}
 
 		// empty line
-		cout << endl << endl;
+		msg << endl << endl;
 
-		ofs << "};" << eol;
-		if (stdvector) {
-			ofs << eol << "#ifdef __cplusplus" << eol << "static const std::vector<unsigned char> "
-					<< hname << "_v(" << hname << ", " << hname << " + sizeof("
-					<< hname << "));" << eol << "#endif" << eol;
+		// header declaring data written to other files & index of shards
+		vector<pair<string, string> > texts;
+		if (incbin || elf || split || sharded) {
+			texts.push_back(make_pair(fout, makeDeclarations(incbin ? bytes_to_go : bytes_written)));
+		}
+		if (sharded) {
+			texts.push_back(make_pair(fout_data, makeShardIndex(bytes_written)));
 		}
-		ofs << eol << "#endif /* " << name_upper_h << " */" << eol;
 
-		ofs.close();
+		for (size_t idx = 0; idx < texts.size(); idx++) {
+			const string path = texts[idx].first;
+			const string text = texts[idx].second;
+			OutputFile ofs_decl;
+			if (!ofs_decl.open(path) || ofs_decl.reserve(text.length())) {
+				msg << "ERROR: could not open file for writing: " << path << endl;
+				return EIO;
+			}
 
-	} catch (const int e) {
-		// close read/write streams
-		if (ifs.is_open()) {
-			ifs.close();
+			ofs_decl.write(text);
+			const int decl_error = ofs_decl.error();
+			ofs_decl.close();
+			if (decl_error) {
+				msg << "ERROR: could not write output file. Code: " << decl_error << endl;
+				return decl_error;
+			}
 		}
-		if (ofs.is_open()) {
-			ofs.close();
+
+		// all outputs are complete, the placeholder is overwritten without reserving (truncating) the header
+		if (!fingerprint.empty()) {
+			OutputFile ofs_mark;
+			const bool marked = ofs_mark.open(fout) && ofs_mark.write(fingerprint);
+			ofs_mark.close();
+			if (!marked) {
+				msg << "ERROR: could not write fingerprint to " << fout << endl;
+				return EIO;
+			}
 		}
 
-		cout << "An error occurred during read/write. Code: " << e << endl;
+		if (!cache_key.empty() && !cacheStore(cache_dir, cache_key, outputs, cache_size)) {
+			msg << "Warning: could not store output in cache " << cache_dir << endl;
+		}
+
+	} catch (const int e) {
+		// close read/write streams
+		ifs.close();
+		ofs.close();
+
+		msg << "An error occurred during read/write. Code: " << e << endl;
 		return e;
 	}
 
@@ -325,8 +1139,555 @@ int convert(const string fin, string fout, string hname, const bool stdvector) {
 	/* *** END: read/write *** */
 
 	//cout << "Wrote " << bytes_written << " bytes" << endl;
-	cout << "Bytes written: " << bytes_written << endl;
+	msg << "Bytes written: " << bytes_written << endl;
+	msg << "Time elapsed:  " << formatDuration(starttime, endtime) << endl;
+	const unsigned long long peak_memory = getPeakMemory();
+	if (peak_memory) msg << "Peak memory:   " << formatSize(peak_memory) << endl;
+	msg << "Exported to:   " << fout << endl;
+	if (incbin || elf || split || sharded) msg << "               " << fout_data << endl;
+	if (sharded) msg << "               " << fout_base << ".*.c" << endl;
+
+	return 0;
+}
+
+
+int convert(const string fin, string fout, string hname, const bool stdvector) {
+	unsigned long long bytes_written, data_size;
+	return convertFile(fin, fout, hname, stdvector, jobs, cout, bytes_written, data_size);
+}
+
+
+/** Retrieves errors & warnings from messages of a conversion. */
+static string getProblems(const string messages) {
+	stringstream problems;
+	stringstream lines(replaceAll(messages, "\r", "\n"));
+	string line;
+	while (getline(lines, line)) {
+		if (line.find("ERROR") != string::npos || line.find("Warning") != string::npos
+				|| line.find("error occurred") != string::npos) {
+			problems << line << endl;
+		}
+	}
+
+	return problems.str();
+}
+
+
+/** Writes a header finding the data of converted files by name.
+ *
+ *  @tparam string path
+ *      Header to be written.
+ *  @tparam vector<string> names
+ *      Names of the data of each file.
+ *  @tparam vector<string> headers
+ *      Header written for each file.
+ *  @tparam vector<long long> sizes
+ *      Number of data bytes of each file.
+ */
+static int writeIndex(const string path, const vector<string>& names, const vector<string>& headers,
+		const vector<unsigned long long>& sizes) {
+	vector<unsigned int> seeds;
+	vector<size_t> slots;
+	if (!buildPerfectHash(names, seeds, slots)) {
+		cout << "ERROR: could not build hash of data names for " << path << endl;
+		return -1;
+	}
+
+	string path_base = getBaseName(path);
+	if (path_base.length() > 2 && path_base.substr(path_base.length() - 2) == ".h") {
+		path_base.erase(path_base.length() - 2);
+	}
+	const string prefix = makeIdentifier(path_base);
+	const string guard = makeGuard(prefix);
+	const string const_macro = guard.substr(0, guard.length() - 2) + "_CONST";
+	const string count = to_string(names.size());
+	const string buckets = to_string(seeds.size());
+
+	stringstream index;
+	index << "#ifndef " << guard << eol << "#define " << guard << eol << eol
+			<< "#include <string.h>" << eol << eol;
+	for (size_t idx = 0; idx < headers.size(); idx++) {
+		string include = getRelativePath(headers[idx], getDirName(path));
+		if (checkEmptyString(include)) include = getAbsolutePath(headers[idx]);
+		index << "#include \"" << replaceAll(include, "\\", "/") << "\"" << eol;
+	}
+
+	// pointers cast from packed data are not constant expressions in C++
+	if (outlen == 8) {
+		index << eol << "#if defined(__cplusplus) && __cplusplus >= 201402L" << eol
+				<< "#define " << const_macro << " constexpr" << eol
+				<< "#else" << eol
+				<< "#define " << const_macro << " const" << eol
+				<< "#endif" << eol << eol;
+	} else {
+		index << eol << "#define " << const_macro << " const" << eol << eol;
+	}
+	index << "typedef struct " << prefix << "_entry {" << eol
+			<< "\tconst char* name;" << eol
+			<< "\tconst unsigned char* data;" << eol
+			<< "\tunsigned long long size;" << eol
+			<< "} " << prefix << "_entry;" << eol << eol
+			<< "/* seeds of a minimal perfect hash, each name has a slot of its own */" << eol
+			<< "static " << const_macro << " unsigned long " << prefix << "_seeds[" << buckets << "] = {" << eol;
+	for (size_t idx = 0; idx < seeds.size(); idx++) {
+		if (idx % nbData == 0) index << "\t";
+		index << seeds[idx] << "UL";
+		if (idx + 1 < seeds.size()) index << (idx % nbData + 1 == nbData ? "," + eol : ", ");
+	}
+	index << eol << "};" << eol << eol;
+
+	vector<size_t> slot_names(names.size());
+	for (size_t idx = 0; idx < names.size(); idx++) {
+		slot_names[slots[idx]] = idx;
+	}
+	index << "static " << const_macro << " " << prefix << "_entry " << prefix << "_entries[" << count << "] = {" << eol;
+	for (size_t slot = 0; slot < slot_names.size(); slot++) {
+		const size_t idx = slot_names[slot];
+		index << "\t{ \"" << names[idx] << "\", " << (outlen == 8 ? "" : "(const unsigned char*) ") << names[idx]
+				<< ", " << sizes[idx] << " }" << (slot + 1 < slot_names.size() ? "," : "") << eol;
+	}
+	index << "};" << eol << eol
+			<< "static inline unsigned long " << prefix << "_hash(const char* name, const unsigned long seed) {" << eol
+			<< "\tunsigned long hash = (2166136261UL ^ (seed * 2654435769UL)) & 0xffffffffUL;" << eol
+			<< "\tfor (; *name != '\\0'; name++) {" << eol
+			<< "\t\thash = ((hash ^ (unsigned char) *name) * 16777619UL) & 0xffffffffUL;" << eol
+			<< "\t}" << eol
+			<< "\thash ^= hash >> 16;" << eol
+			<< "\thash = (hash * 2246822507UL) & 0xffffffffUL;" << eol
+			<< "\thash ^= hash >> 13;" << eol
+			<< "\thash = (hash * 3266489909UL) & 0xffffffffUL;" << eol
+			<< "\treturn hash ^ (hash >> 16);" << eol
+			<< "}" << eol << eol
+			<< "/* finds data by its name without searching, NULL if not found */" << eol
+			<< "static inline const unsigned char* " << prefix << "_find(const char* name, unsigned long long* size) {"
+			<< eol
+			<< "\tconst " << prefix << "_entry* entry = &" << prefix << "_entries[" << prefix << "_hash(name, "
+			<< prefix << "_seeds[" << prefix << "_hash(name, 0) % " << buckets << "]) % " << count << "];" << eol
+			<< "\tif (strcmp(name, entry->name) != 0) return NULL;" << eol
+			<< "\tif (size != NULL) *size = entry->size;" << eol
+			<< "\treturn entry->data;" << eol
+			<< "}" << eol << eol
+			<< "#endif /* " << guard << " */" << eol;
+
+	OutputFile ofs;
+	const string text = index.str();
+	if (!ofs.open(path) || ofs.reserve(text.length())) {
+		cout << "ERROR: could not open file for writing: " << path << endl;
+		return EIO;
+	}
+
+	ofs.write(text);
+	const int write_error = ofs.error();
+	ofs.close();
+	if (write_error) {
+		cout << "ERROR: could not write output file. Code: " << write_error << endl;
+	}
+
+	return write_error;
+}
+
+
+int convertBatch(const vector<string> files, const string outdir, const bool stdvector, const string index) {
+	// data of files without a contiguous buffer cannot be found by the index
+	if (!index.empty() && shard_size > 0) {
+		cout << "\nERROR: Sharded output cannot be written with an index" << endl;
+		return EINVAL;
+	}
+
+	// index finds data by the names used in the headers
+	vector<string> names;
+	set<string> unique_names;
+
+	// outputs must not overwrite each other
+	vector<string> targets;
+	set<string> unique_targets;
+	for (size_t idx = 0; idx < files.size(); idx++) {
+		if (files[idx] == "-") {
+			cout << "\nERROR: Standard input cannot be converted with other files" << endl;
+			return EINVAL;
+		}
+
+		const string target = getTargetPath(files[idx], checkEmptyString(outdir) ? ""
+				: joinPath(outdir, getBaseName(files[idx]) + ".h"));
+		if (!unique_targets.insert(target).second) {
+			cout << "\nERROR: Several input files are written to " << target << endl;
+			return EINVAL;
+		}
+		targets.push_back(target);
+
+		const string name = makeIdentifier(getBaseName(files[idx]));
+		if (!index.empty() && !unique_names.insert(name).second) {
+			cout << "\nERROR: Several input files are named " << name << " in the index" << endl;
+			return EINVAL;
+		}
+		names.push_back(name);
+	}
+
+	const long long starttime = currentTimeMillis();
+
+	// each file is formatted on a single thread, files are converted concurrently
+	vector<int> results(files.size(), 0);
+	vector<unsigned long long> sizes(files.size(), 0);
+	unsigned long long total_written = 0;
+	size_t next_file = 0;
+#if B2H_THREADS
+	std::mutex mutex;
+#endif
+
+	const auto work = [&]() {
+		for (;;) {
+			size_t idx;
+			{
+#if B2H_THREADS
+				lock_guard<std::mutex> lock(mutex);
+#endif
+				if (cancelled || next_file >= files.size()) {
+					return;
+				}
+				idx = next_file++;
+			}
+
+			stringstream messages;
+			unsigned long long bytes_written = 0, data_size = 0;
+			const int ret = convertFile(files[idx], targets[idx], "", stdvector, 1, messages, bytes_written,
+					data_size);
+			const string problems = getProblems(messages.str());
+
+#if B2H_THREADS
+			lock_guard<std::mutex> lock(mutex);
+#endif
+			results[idx] = ret;
+			sizes[idx] = data_size;
+			total_written += bytes_written;
+			if (!problems.empty()) {
+				cout << files[idx] << ":" << endl << problems;
+			}
+		}
+	};
+
+	const unsigned int workers = (unsigned int) min((size_t) jobs, files.size());
+#if B2H_THREADS
+	vector<thread> threads;
+	for (unsigned int idx = 1; idx < workers; idx++) {
+		threads.push_back(thread(work));
+	}
+	work();
+	for (size_t idx = 0; idx < threads.size(); idx++) {
+		threads[idx].join();
+	}
+#else
+	work();
+#endif
+
+	const long long endtime = currentTimeMillis();
+
+	int ret = 0;
+	size_t failed = 0;
+	for (size_t idx = 0; idx < results.size(); idx++) {
+		if (results[idx] != 0) {
+			if (ret == 0) ret = results[idx];
+			failed++;
+		}
+	}
+	if (ret == 0 && cancelled) {
+		ret = ECANCELED;
+	}
+	if (ret == 0 && !index.empty()) {
+		ret = writeIndex(index, names, targets, sizes);
+	}
+
+	cout << endl;
+	cout << "Files converted: " << files.size() - failed << " of " << files.size();
+	if (workers > 1) cout << " (" << workers << " threads)";
+	cout << endl;
+	if (failed) cout << "Files failed:    " << failed << endl;
+	cout << "Bytes written:   " << total_written << endl;
+	cout << "Time elapsed:    " << formatDuration(starttime, endtime) << endl;
+	const unsigned long long peak_memory = getPeakMemory();
+	if (peak_memory) cout << "Peak memory:     " << formatSize(peak_memory) << endl;
+	if (ret == 0 && !index.empty()) cout << "Index:           " << index << endl;
+
+	return ret;
+}
+
+
+/** Escapes a path for a C string literal. */
+static string escapePath(const string path) {
+	stringstream escaped;
+	for (size_t idx = 0; idx < path.length(); idx++) {
+		const unsigned char c = path[idx];
+		if (c == '"' || c == '\\') {
+			escaped << '\\' << c;
+		} else if (c < 0x20 || c == 0x7f || c == '?') {
+			// octal escapes of three digits are never continued by following text,
+			// "?" could start a trigraph
+			escaped << '\\' << oct << setw(3) << setfill('0') << (unsigned int) c << dec;
+		} else {
+			escaped << c;
+		}
+	}
+
+	return escaped.str();
+}
+
+int convertBundle(const string dir, string fout, string hname) {
+	// options for single files that do not apply to the files of a bundle
+	const pair<bool, string> unsupported[] = {
+		make_pair(outlen != 8, "--pack"),
+		make_pair(outformat != "array", "--format"),
+		make_pair(offset > 0 || length > 0, "--offset & --length"),
+		make_pair(split || shard_size > 0, "--split & --shard-size"),
+		make_pair(dataview != "none", "--view"),
+		make_pair(data_align > 0 || !data_section.empty(), "--align & --section"),
+		make_pair(skip_unchanged || !cache_dir.empty(), "--skip-unchanged & --cache-dir"),
+	};
+	for (size_t idx = 0; idx < len(unsupported); idx++) {
+		if (unsupported[idx].first) {
+			cout << "\nERROR: " << unsupported[idx].second << " cannot be used for bundles" << endl;
+			return EINVAL;
+		}
+	}
+
+	const bool to_stdout = fout == "-";
+	if (checkEmptyString(hname)) {
+		hname = getBaseName(dir);
+	}
+	hname = makeIdentifier(hname);
+	fout = to_stdout ? "-" : getTargetPath(dir, fout);
+	const string name_upper_h = makeGuard(hname);
+
+	// keep messages out of the generated header
+	const StdoutRedirect redirect(to_stdout);
+
+	if (nbData == 0) {
+		cout << "ERROR: number of bytes per line must be greater than 0" << endl;
+		return -1;
+	}
+
+	signal(SIGINT, sigintHandler);
+	const long long starttime = currentTimeMillis();
+
+	// the index is searched in byte order of the paths, as compared by strcmp
+	vector<TreeFile> files = findFiles(dir, jobs);
+	const string abs_fout = to_stdout ? "" : getAbsolutePath(fout);
+	for (size_t idx = 0; idx < files.size(); idx++) {
+		// a header written into the directory is not part of the next bundle
+		if (!abs_fout.empty() && getBaseName(normalizePath(files[idx].path)) == getBaseName(fout)
+				&& getAbsolutePath(joinPath(dir, files[idx].path)) == abs_fout) {
+			files.erase(files.begin() + idx);
+			break;
+		}
+	}
+	sort(files.begin(), files.end(), [](const TreeFile& a, const TreeFile& b) { return a.path < b.path; });
+
+	if (files.empty()) {
+		cout << "ERROR: no files found in " << dir << endl;
+		return ENOENT;
+	}
+
+	const LineFormat fmt = {1, nbData, false, showDataContent, eol, false};
+	const unsigned int line_bytes = fmt.lineBytes();
+	const size_t read_size = chunk_size > line_bytes ? chunk_size - chunk_size % line_bytes : line_bytes;
+
+	// files begin on new lines, only the last line of the array has no separator
+	size_t last_data = files.size();
+	unsigned long long data_length = 0;
+	for (size_t idx = 0; idx < files.size(); idx++) {
+		if (files[idx].size > 0) last_data = idx;
+		data_length += files[idx].size;
+	}
+
+	stringstream head;
+	head << "#ifndef " << name_upper_h << eol << "#define " << name_upper_h << eol << eol
+			<< "#include <string.h>" << eol << eol
+			<< "static const unsigned char " << hname << "[] = {" << eol;
+
+	// formatted text has a known length, so each file is written at its own position
+	vector<string> comments;
+	vector<unsigned long long> positions;
+	unsigned long long pos = head.str().length();
+	for (size_t idx = 0; idx < files.size(); idx++) {
+		comments.push_back("\t/* " + replaceAll(files[idx].path, "*/", "*.") + " */" + eol);
+		positions.push_back(pos);
+		pos += comments[idx].length() + formattedSize(files[idx].size, fmt, idx == last_data);
+	}
+
+	stringstream tail;
+	// an initializer needs at least one element
+	if (data_length == 0) tail << "\t0" << eol;
+	tail << "};" << eol << eol
+			<< "/* files in " << hname << ", sorted by path */" << eol
+			<< "typedef struct " << hname << "_file {" << eol
+			<< "\tconst char* path;" << eol
+			<< "\tunsigned long long offset;" << eol
+			<< "\tunsigned long long size;" << eol
+			<< "} " << hname << "_file;" << eol << eol
+			<< "static const " << hname << "_file " << hname << "_files[" << files.size() << "] = {" << eol;
+	unsigned long long data_offset = 0;
+	for (size_t idx = 0; idx < files.size(); idx++) {
+		tail << "\t{ \"" << escapePath(files[idx].path) << "\", " << data_offset << ", " << files[idx].size << " }"
+				<< (idx + 1 < files.size() ? "," : "") << eol;
+		data_offset += files[idx].size;
+	}
+	tail << "};" << eol << eol
+			<< "static const unsigned long long " << hname << "_count = " << files.size() << ";" << eol << eol
+			<< "/* finds a file by its path relative to the bundled directory, NULL if not found */" << eol
+			<< "static inline const unsigned char* " << hname << "_find(const char* path, unsigned long long* size) {"
+			<< eol
+			<< "\tunsigned long long lo = 0;" << eol
+			<< "\tunsigned long long hi = " << hname << "_count;" << eol
+			<< "\twhile (lo < hi) {" << eol
+			<< "\t\tconst unsigned long long mid = lo + (hi - lo) / 2;" << eol
+			<< "\t\tconst int cmp = strcmp(path, " << hname << "_files[mid].path);" << eol
+			<< "\t\tif (cmp == 0) {" << eol
+			<< "\t\t\tif (size != NULL) *size = " << hname << "_files[mid].size;" << eol
+			<< "\t\t\treturn " << hname << " + " << hname << "_files[mid].offset;" << eol
+			<< "\t\t} else if (cmp < 0) {" << eol
+			<< "\t\t\thi = mid;" << eol
+			<< "\t\t} else {" << eol
+			<< "\t\t\tlo = mid + 1;" << eol
+			<< "\t\t}" << eol
+			<< "\t}" << eol
+			<< "\treturn NULL;" << eol
+			<< "}" << eol << eol
+			<< "#endif /* " << name_upper_h << " */" << eol;
+
+	cout << "Files:      " << files.size() << " (" << data_length << " bytes)" << endl;
+	cout << "Chunk size: " << read_size << " bytes" << endl << endl;
+
+	OutputFile ofs;
+	if (!ofs.open(fout)) {
+		cout << "ERROR: could not open file for writing" << endl;
+		return EIO;
+	}
+
+	const int reserve_error = ofs.reserve(pos + tail.str().length());
+	if (reserve_error) {
+		cout << "ERROR: could not allocate " << pos + tail.str().length() << " bytes for output" << endl;
+		ofs.close();
+		return reserve_error;
+	}
+	ofs.write(head.str());
+
+	// files are formatted concurrently, unless output can only be appended
+	const unsigned int workers = ofs.isPositional() ? (unsigned int) min((size_t) jobs, files.size()) : 1;
+	size_t next_file = 0;
+	size_t files_done = 0;
+	int ret = 0;
+	string error_msg;
+#if B2H_THREADS
+	std::mutex mutex;
+#endif
+
+	const auto work = [&]() {
+		vector<char> buffer;
+		string text;
+		for (;;) {
+			size_t idx;
+			{
+#if B2H_THREADS
+				lock_guard<std::mutex> lock(mutex);
+#endif
+				if (ret != 0 || cancelled || next_file >= files.size()) {
+					return;
+				}
+				idx = next_file++;
+			}
+
+			const string path = joinPath(dir, files[idx].path);
+			const auto emit = [&](const unsigned long long at, const string& out_text) {
+				return workers > 1 ? ofs.writeAt(at, out_text.data(), out_text.size()) : ofs.write(out_text);
+			};
+
+			// size is checked as the positions of following files depend on it
+			InputFile ifs;
+			int file_error = 0;
+			string file_msg;
+			if (!ifs.open(path) || !ifs.select(0, files[idx].size)) {
+				file_error = EIO;
+				file_msg = "could not open file for reading: " + path;
+			} else if (ifs.size() != files[idx].size) {
+				file_error = EAGAIN;
+				file_msg = "file changed while converting: " + path;
+			} else {
+				unsigned long long at = positions[idx];
+				emit(at, comments[idx]);
+				at += comments[idx].length();
+
+				if (!ifs.isMapped()) buffer.resize(read_size);
+				for (unsigned long long done = 0; done < files[idx].size && !cancelled;) {
+					const size_t size = (size_t) min(files[idx].size - done, (unsigned long long) read_size);
+					const unsigned char* data = ifs.read(buffer.data(), size);
+					if (data == NULL) {
+						file_error = EIO;
+						file_msg = "unexpected end of file: " + path;
+						break;
+					}
+
+					done += size;
+					text.clear();
+					formatLines(text, data, size, fmt, idx == last_data && done == files[idx].size);
+					ifs.release(data + size);
+					emit(at, text);
+					at += text.length();
+				}
+			}
+			ifs.close();
+
+#if B2H_THREADS
+			lock_guard<std::mutex> lock(mutex);
+#endif
+			if (file_error && ret == 0) {
+				ret = file_error;
+				error_msg = file_msg;
+			}
+			files_done++;
+			cout << "\rWriting file " << files_done << " out of " << files.size() << " (Ctrl+C to cancel)"
+					<< std::flush;
+		}
+	};
+
+#if B2H_THREADS
+	vector<thread> threads;
+	for (unsigned int idx = 1; idx < workers; idx++) {
+		threads.push_back(thread(work));
+	}
+	work();
+	for (size_t idx = 0; idx < threads.size(); idx++) {
+		threads[idx].join();
+	}
+#else
+	work();
+#endif
+
+	if (ret == 0 && cancelled) {
+		ret = ECANCELED;
+	}
+	if (ret != 0) {
+		if (!error_msg.empty()) cout << "\nERROR: " << error_msg << endl;
+		ofs.close();
+		return ret;
+	}
+
+	if (workers > 1) {
+		ofs.skip(pos - ofs.tell());
+	}
+	ofs.write(tail.str());
+
+	const int write_error = ofs.error();
+	ofs.close();
+	if (write_error) {
+		cout << "\nERROR: could not write output file. Code: " << write_error << endl;
+		return write_error;
+	}
+
+	const long long endtime = currentTimeMillis();
+
+	cout << endl << endl;
+	cout << "Bytes written: " << data_length << endl;
 	cout << "Time elapsed:  " << formatDuration(starttime, endtime) << endl;
+	const unsigned long long peak_memory = getPeakMemory();
+	if (peak_memory) cout << "Peak memory:   " << formatSize(peak_memory) << endl;
 	cout << "Exported to:   " << fout << endl;
 
 	return 0;
@@ -0,0 +1,163 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+#include "elf.h"
+
+using namespace std;
+
+
+// section indexes
+enum { SHN_RODATA = 1, SHN_NOTE, SHN_SYMTAB, SHN_STRTAB, SHN_SHSTRTAB, SHN_COUNT };
+
+/** Rounds value up to a multiple of alignment. */
+static unsigned long long alignUp(const unsigned long long value, const unsigned int align) {
+	return (value + align - 1) / align * align;
+}
+
+/** Appends number in little endian byte order. */
+static void putLE(string& text, unsigned long long value, const unsigned int bytes) {
+	for (unsigned int idx = 0; idx < bytes; idx++) {
+		text.push_back((char) (value & 0xff));
+		value >>= 8;
+	}
+}
+
+
+ElfObject::ElfObject(const unsigned int bits, const string symbol, const unsigned long long size,
+		const unsigned int align, const string sect)
+		: bits(bits), symbol(symbol), size(size), align(align > 0 ? align : 16),
+		section(sect.empty() ? ".rodata" : sect), machine(0), flags(0) {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	machine = bits == 64 ? 62 : 3; // EM_X86_64 : EM_386
+#elif defined(__aarch64__) || defined(__arm__)
+	machine = bits == 64 ? 183 : 40; // EM_AARCH64 : EM_ARM
+	if (bits == 32) flags = 0x05000000; // EABI version 5
+#endif
+
+	ehdr_size = bits == 64 ? 64 : 52;
+	shdr_size = bits == 64 ? 64 : 40;
+	sym_size = bits == 64 ? 24 : 16;
+
+	strtab.push_back('\0');
+	strtab += symbol + '\0' + symbol + "_end" + '\0' + symbol + "_size" + '\0';
+	shstrtab.push_back('\0');
+	shstrtab += section + '\0' + ".note.GNU-stack" + '\0' + ".symtab" + '\0' + ".strtab"
+			+ '\0' + ".shstrtab" + '\0';
+
+	// data section: data, 64 bit size
+	data_offset = alignUp(ehdr_size, 16);
+	size_offset = alignUp(size, 8);
+	symtab_offset = alignUp(data_offset + size_offset + 8, 8);
+	strtab_offset = symtab_offset + 4 * sym_size;
+	shstrtab_offset = strtab_offset + strtab.length();
+	shdr_offset = alignUp(shstrtab_offset + shstrtab.length(), 8);
+}
+
+
+string ElfObject::head() const {
+	string text;
+	text += "\x7f" "ELF";
+	text.push_back(bits == 64 ? 2 : 1); // class
+	text.push_back(1); // little endian
+	text.push_back(1); // version
+	text.append(9, '\0'); // System V ABI & padding
+
+	putLE(text, 1, 2); // relocatable
+	putLE(text, machine, 2);
+	putLE(text, 1, 4); // version
+	putWord(text, 0); // entry point
+	putWord(text, 0); // program headers
+	putWord(text, shdr_offset);
+	putLE(text, flags, 4);
+	putLE(text, ehdr_size, 2);
+	putLE(text, 0, 2); // program header size
+	putLE(text, 0, 2); // program header count
+	putLE(text, shdr_size, 2);
+	putLE(text, SHN_COUNT, 2);
+	putLE(text, SHN_SHSTRTAB, 2);
+
+	text.append(data_offset - text.length(), '\0');
+	return text;
+}
+
+
+string ElfObject::tail() const {
+	string text;
+	text.append(size_offset - size, '\0');
+	putLE(text, size, 8);
+	text.append(symtab_offset - data_offset - size_offset - 8, '\0');
+
+	// local symbols first, all others are global
+	const unsigned int name_offset = 1;
+	const unsigned int end_offset = name_offset + symbol.length() + 1;
+	const unsigned int size_name_offset = end_offset + symbol.length() + 5;
+	putSymbol(text, 0, 0, 0, 0, 0);
+	putSymbol(text, name_offset, 0x11, SHN_RODATA, 0, size); // global object
+	putSymbol(text, end_offset, 0x10, SHN_RODATA, size, 0); // global, no type
+	putSymbol(text, size_name_offset, 0x11, SHN_RODATA, size_offset, 8);
+
+	text += strtab;
+	text += shstrtab;
+	text.append(shdr_offset - shstrtab_offset - shstrtab.length(), '\0');
+
+	const unsigned int rodata_name = 1;
+	const unsigned int note_name = rodata_name + section.length() + 1;
+	const unsigned int symtab_name = note_name + 16;
+	const unsigned int strtab_name = symtab_name + 8;
+	const unsigned int shstrtab_name = strtab_name + 8;
+	putSection(text, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+	putSection(text, rodata_name, 1, 2, data_offset, size_offset + 8, 0, 0, align, 0); // progbits, alloc
+	putSection(text, note_name, 1, 0, symtab_offset, 0, 0, 0, 1, 0); // non-executable stack
+	putSection(text, symtab_name, 2, 0, symtab_offset, 4 * sym_size, SHN_STRTAB, 1, bits / 8, sym_size);
+	putSection(text, strtab_name, 3, 0, strtab_offset, strtab.length(), 0, 0, 1, 0);
+	putSection(text, shstrtab_name, 3, 0, shstrtab_offset, shstrtab.length(), 0, 0, 1, 0);
+
+	return text;
+}
+
+
+/** Appends an address or offset sized for the object class. */
+void ElfObject::putWord(string& text, const unsigned long long value) const {
+	putLE(text, value, bits / 8);
+}
+
+
+/** Appends a section header. */
+void ElfObject::putSection(string& text, const unsigned int name, const unsigned int type,
+		const unsigned long long flags, const unsigned long long offset, const unsigned long long size,
+		const unsigned int link, const unsigned int info, const unsigned int align,
+		const unsigned int entsize) const {
+	putLE(text, name, 4);
+	putLE(text, type, 4);
+	putWord(text, flags);
+	putWord(text, 0); // address
+	putWord(text, offset);
+	putWord(text, size);
+	putLE(text, link, 4);
+	putLE(text, info, 4);
+	putWord(text, align);
+	putWord(text, entsize);
+}
+
+
+/** Appends a symbol table entry. */
+void ElfObject::putSymbol(string& text, const unsigned int name, const unsigned char info,
+		const unsigned int shndx, const unsigned long long value, const unsigned long long size) const {
+	putLE(text, name, 4);
+	if (bits == 64) {
+		text.push_back(info);
+		text.push_back(0); // default visibility
+		putLE(text, shndx, 2);
+		putLE(text, value, 8);
+		putLE(text, size, 8);
+	} else {
+		putLE(text, value, 4);
+		putLE(text, size, 4);
+		text.push_back(info);
+		text.push_back(0);
+		putLE(text, shndx, 2);
+	}
+}
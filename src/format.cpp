@@ -0,0 +1,318 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+#include "format.h"
+#include "hexenc.h"
+
+#include <cstring> // memcpy,memset
+
+using namespace std;
+
+
+/** Printable representation of every possible byte value. */
+struct PrintableTable {
+	char chars[256];
+
+	PrintableTable() {
+		for (int b = 0; b < 256; b++) {
+			chars[b] = toPrintableChar((char) b);
+		}
+	}
+};
+
+static const PrintableTable printable_table;
+
+/** Shortest string literal representation of every possible byte value.
+ *
+ *  Printable characters are passed through. Other bytes use octal escapes,
+ *  which are never longer than hex escapes & end after three digits.
+ */
+struct LiteralTable {
+	char text[256][4];
+	unsigned char length[256];
+	bool octal[256]; // escape can be followed by a digit
+
+	LiteralTable() {
+		for (int b = 0; b < 256; b++) {
+			octal[b] = false;
+			if (b == '"' || b == '\\') {
+				text[b][0] = '\\';
+				text[b][1] = b;
+				length[b] = 2;
+			} else if (b == '\n' || b == '\r' || b == '\t') {
+				text[b][0] = '\\';
+				text[b][1] = b == '\n' ? 'n' : b == '\r' ? 'r' : 't';
+				length[b] = 2;
+			} else if (b >= ' ' && b <= '~') {
+				text[b][0] = b;
+				length[b] = 1;
+			} else {
+				text[b][0] = '\\';
+				length[b] = 1;
+				if (b >= 64) text[b][length[b]++] = '0' + (b >> 6);
+				if (b >= 8) text[b][length[b]++] = '0' + ((b >> 3) & 7);
+				text[b][length[b]++] = '0' + (b & 7);
+				octal[b] = true;
+			}
+		}
+	}
+};
+
+static const LiteralTable literal_table;
+
+// scratch space reserved past the end of formatted text
+static const size_t format_slack = 128;
+
+
+char toPrintableChar(char c) {
+	if (c >= ' ' && c <= '~') {
+		return c;
+	} else {
+		return '.';
+	}
+}
+
+
+/** Calculates text length of a single line.
+ *
+ *  @tparam int words
+ *      Number of words on the line.
+ *  @tparam LineFormat fmt
+ *      Line layout.
+ *  @tparam bool final
+ *      `true` if this is the last line of the array.
+ */
+static size_t lineSize(const size_t words, const LineFormat& fmt, const bool final) {
+	// "\t" + "0x..." tokens joined by ", "
+	size_t sz = 1 + words * (2 + 2 * fmt.wordbytes) + (words - 1) * 2;
+	if (final) {
+		if (fmt.showDataContent) {
+			// padding + "  /* " + comment + " */"
+			const size_t line_bytes = fmt.lineBytes();
+			sz += (line_bytes - (words * fmt.wordbytes) % line_bytes) * 6 + 5 + words + 3;
+		}
+	} else {
+		// ","
+		sz += 1;
+		if (fmt.showDataContent) {
+			// " /* " + comment + " */"
+			sz += 4 + words + 3;
+		}
+	}
+
+	return sz + fmt.eol.length();
+}
+
+
+unsigned long long formattedSize(const unsigned long long size, const LineFormat& fmt,
+		const bool last) {
+	if (fmt.literal) {
+		// "\t\"" + up to 4 characters per byte + "\"" + eol
+		const unsigned long long lines = (size + fmt.nbData - 1) / fmt.nbData;
+		return size * 4 + lines * (3 + fmt.eol.length());
+	}
+
+	const unsigned long long words = size / fmt.wordbytes;
+	const unsigned long long full_lines = words / fmt.nbData;
+	const size_t remainder = words % fmt.nbData;
+
+	const unsigned long long full_size = lineSize(fmt.nbData, fmt, false);
+	if (!last) {
+		// a shorter line keeps its separator, e.g. at the end of a bundled file
+		return full_lines * full_size + (remainder > 0 ? lineSize(remainder, fmt, false) : 0);
+	}
+
+	if (remainder > 0) {
+		return full_lines * full_size + lineSize(remainder, fmt, true);
+	} else if (full_lines > 0) {
+		return (full_lines - 1) * full_size + lineSize(fmt.nbData, fmt, true);
+	}
+
+	return 0;
+}
+
+
+/** Appends data content comment text of a line.
+ *
+ *  @tparam int WB
+ *      Bytes per word (content of last byte of each word is shown).
+ */
+template <unsigned int WB>
+static inline char* appendContent(char* out, const unsigned char* line, const size_t nbytes) {
+	for (const unsigned char* b = line + WB - 1; b < line + nbytes; b += WB) {
+		// "*/" would end the comment early
+		const char c = printable_table.chars[*b];
+		*out = c == '/' && out[-1] == '*' ? '.' : c;
+		out++;
+	}
+	memcpy(out, " */", 3);
+
+	return out + 3;
+}
+
+
+/** Formats lines for one combination of word size, byte order & comment mode.
+ *
+ *  All lines but the final one share the same layout, so each specialization
+ *  writes them without any per line or per word decisions.
+ *
+ *  @tparam int WB
+ *      Bytes per word (1/2/4/8).
+ *  @tparam bool Swap
+ *      Reverse byte order of words.
+ *  @tparam bool ShowContent
+ *      Append data content comment to each line.
+ */
+template <unsigned int WB, bool Swap, bool ShowContent>
+static size_t emitLines(char* out, char* out_end, const unsigned char* data,
+		const size_t size, const LineFormat& fmt, const bool last) {
+	char* const out_start = out;
+	const size_t line_bytes = fmt.nbData * WB;
+	const size_t eol_length = fmt.eol.length();
+	const char* eol = fmt.eol.c_str();
+	const HexEncoder encode = getHexEncoder(WB, Swap);
+
+	const unsigned char* const data_end = data + size;
+	size_t full_lines = size / line_bytes;
+	size_t tail = size % line_bytes;
+	if (last && tail == 0 && full_lines > 0) {
+		// final line is written separately
+		full_lines--;
+		tail = line_bytes;
+	}
+
+	const unsigned char* pos = data;
+	for (size_t idx = 0; idx < full_lines; idx++) {
+		*out++ = '\t';
+		out = encode(out, out_end, pos, line_bytes, data_end - pos);
+
+		// keep "," but drop trailing space
+		out -= 1;
+		if (ShowContent) {
+			memcpy(out, " /* ", 4);
+			out = appendContent<WB>(out + 4, pos, line_bytes);
+		}
+
+		memcpy(out, eol, eol_length);
+		out += eol_length;
+		pos += line_bytes;
+	}
+
+	if (tail > 0) {
+		*out++ = '\t';
+		out = encode(out, out_end, pos, tail, tail);
+
+		if (last) {
+			// drop separator after last word
+			out -= 2;
+			if (ShowContent) {
+				const size_t pad = (line_bytes - tail % line_bytes) * 6;
+				memset(out, ' ', pad);
+				memcpy(out + pad, "  /* ", 5);
+				out += pad + 5;
+			}
+		} else {
+			out -= 1;
+			if (ShowContent) {
+				memcpy(out, " /* ", 4);
+				out += 4;
+			}
+		}
+
+		if (ShowContent) {
+			out = appendContent<WB>(out, pos, tail);
+		}
+
+		memcpy(out, eol, eol_length);
+		out += eol_length;
+	}
+
+	return out - out_start;
+}
+
+
+/** Formats lines of bytes as string literals. */
+static size_t emitLiteral(char* out, const unsigned char* data, const size_t size, const LineFormat& fmt) {
+	char* const out_start = out;
+	const size_t eol_length = fmt.eol.length();
+	const char* eol = fmt.eol.c_str();
+
+	const unsigned char* pos = data;
+	const unsigned char* const data_end = data + size;
+	while (pos < data_end) {
+		const unsigned char* const line_end = data_end - pos > fmt.nbData ? pos + fmt.nbData : data_end;
+
+		*out++ = '\t';
+		*out++ = '"';
+		for (; pos < line_end; pos++) {
+			const unsigned char b = *pos;
+			if (b == '?' && out[-1] == '?') {
+				// don't form trigraphs
+				*out++ = '\\';
+			}
+
+			memcpy(out, literal_table.text[b], 4);
+			if (literal_table.octal[b] && literal_table.length[b] < 4 && pos + 1 < line_end
+					&& pos[1] >= '0' && pos[1] <= '7') {
+				// following digit would extend the escape
+				out[1] = '0' + (b >> 6);
+				out[2] = '0' + ((b >> 3) & 7);
+				out[3] = '0' + (b & 7);
+				out += 4;
+			} else {
+				out += literal_table.length[b];
+			}
+		}
+		*out++ = '"';
+
+		memcpy(out, eol, eol_length);
+		out += eol_length;
+	}
+
+	return out - out_start;
+}
+
+
+typedef size_t (*LineEmitter)(char* out, char* out_end, const unsigned char* data,
+		const size_t size, const LineFormat& fmt, const bool last);
+
+/** Specializations indexed by word size (1/2/4/8 bytes), swap & comment mode. */
+static const LineEmitter line_emitters[4][2][2] = {
+	{{emitLines<1, false, false>, emitLines<1, false, true>},
+		{emitLines<1, true, false>, emitLines<1, true, true>}},
+	{{emitLines<2, false, false>, emitLines<2, false, true>},
+		{emitLines<2, true, false>, emitLines<2, true, true>}},
+	{{emitLines<4, false, false>, emitLines<4, false, true>},
+		{emitLines<4, true, false>, emitLines<4, true, true>}},
+	{{emitLines<8, false, false>, emitLines<8, false, true>},
+		{emitLines<8, true, false>, emitLines<8, true, true>}},
+};
+
+
+size_t formatLines(char* out, char* out_end, const unsigned char* data,
+		const size_t size, const LineFormat& fmt, const bool last) {
+	if (fmt.literal) {
+		return emitLiteral(out, data, size, fmt);
+	}
+
+	const unsigned int size_idx = fmt.wordbytes == 8 ? 3 : fmt.wordbytes == 4 ? 2 : fmt.wordbytes - 1;
+	const LineEmitter emit = line_emitters[size_idx][fmt.swap][fmt.showDataContent];
+
+	return emit(out, out_end, data, size, fmt, last);
+}
+
+
+void formatLines(string& buf, const unsigned char* data, const size_t size,
+		const LineFormat& fmt, const bool last) {
+	const size_t start = buf.size();
+	const size_t length = formattedSize(size, fmt, last);
+
+	// extra room lets encoders store whole vectors at the end of each line
+	buf.resize(start + length + format_slack);
+	const size_t written = formatLines(&buf[start], &buf[start] + length + format_slack,
+			data, size, fmt, last);
+	buf.resize(start + written);
+}
@@ -0,0 +1,198 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+#include "hash.h"
+
+#include <algorithm> // min,sort
+#include <cstring> // memcpy
+#include <set>
+
+using namespace std;
+
+
+static const unsigned long long prime1 = 11400714785074694791ULL;
+static const unsigned long long prime2 = 14029467366897019727ULL;
+static const unsigned long long prime3 = 1609587929392839161ULL;
+static const unsigned long long prime4 = 9650029242287828579ULL;
+static const unsigned long long prime5 = 2870177450012600261ULL;
+
+static inline unsigned long long rotl(const unsigned long long value, const unsigned int bits) {
+	return (value << bits) | (value >> (64 - bits));
+}
+
+/** Reads a little endian number (compiled to a single load on little endian systems). */
+static inline unsigned long long readLE(const unsigned char* data, const unsigned int bytes) {
+	unsigned long long value = 0;
+	for (unsigned int idx = 0; idx < bytes; idx++) {
+		value |= (unsigned long long) data[idx] << (8 * idx);
+	}
+	return value;
+}
+
+static inline unsigned long long mixRound(unsigned long long acc, const unsigned long long input) {
+	acc += input * prime2;
+	return rotl(acc, 31) * prime1;
+}
+
+static inline unsigned long long mergeRound(unsigned long long acc, const unsigned long long value) {
+	acc ^= mixRound(0, value);
+	return acc * prime1 + prime4;
+}
+
+
+Hash64::Hash64(const unsigned long long seed) : buffered(0), total(0) {
+	acc[0] = seed + prime1 + prime2;
+	acc[1] = seed + prime2;
+	acc[2] = seed;
+	acc[3] = seed - prime1;
+}
+
+
+void Hash64::update(const unsigned char* data, size_t size) {
+	total += size;
+
+	// complete a stripe started by a previous part
+	if (buffered > 0) {
+		const size_t fill = min(size, sizeof(buffer) - buffered);
+		memcpy(buffer + buffered, data, fill);
+		buffered += fill;
+		data += fill;
+		size -= fill;
+		if (buffered < sizeof(buffer)) {
+			return;
+		}
+
+		for (unsigned int lane = 0; lane < 4; lane++) {
+			acc[lane] = mixRound(acc[lane], readLE(buffer + 8 * lane, 8));
+		}
+		buffered = 0;
+	}
+
+	// independent lanes let stripes be processed at full speed
+	unsigned long long v0 = acc[0], v1 = acc[1], v2 = acc[2], v3 = acc[3];
+	for (; size >= 32; data += 32, size -= 32) {
+		v0 = mixRound(v0, readLE(data, 8));
+		v1 = mixRound(v1, readLE(data + 8, 8));
+		v2 = mixRound(v2, readLE(data + 16, 8));
+		v3 = mixRound(v3, readLE(data + 24, 8));
+	}
+	acc[0] = v0;
+	acc[1] = v1;
+	acc[2] = v2;
+	acc[3] = v3;
+
+	memcpy(buffer, data, size);
+	buffered = size;
+}
+
+
+unsigned long long Hash64::digest() const {
+	unsigned long long hash;
+	if (total >= 32) {
+		hash = rotl(acc[0], 1) + rotl(acc[1], 7) + rotl(acc[2], 12) + rotl(acc[3], 18);
+		for (unsigned int lane = 0; lane < 4; lane++) {
+			hash = mergeRound(hash, acc[lane]);
+		}
+	} else {
+		// lanes still hold the seed
+		hash = acc[2] + prime5;
+	}
+	hash += total;
+
+	const unsigned char* data = buffer;
+	size_t size = buffered;
+	for (; size >= 8; data += 8, size -= 8) {
+		hash ^= mixRound(0, readLE(data, 8));
+		hash = rotl(hash, 27) * prime1 + prime4;
+	}
+	if (size >= 4) {
+		hash ^= readLE(data, 4) * prime1;
+		hash = rotl(hash, 23) * prime2 + prime3;
+		data += 4;
+		size -= 4;
+	}
+	for (; size > 0; data++, size--) {
+		hash ^= *data * prime5;
+		hash = rotl(hash, 11) * prime1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= prime2;
+	hash ^= hash >> 29;
+	hash *= prime3;
+	hash ^= hash >> 32;
+
+	return hash;
+}
+
+
+unsigned int hashName(const string name, const unsigned int seed) {
+	// masked like the generated code, where unsigned long may have 64 bits
+	unsigned long hash = (2166136261UL ^ (seed * 2654435769UL)) & 0xffffffffUL;
+	for (size_t idx = 0; idx < name.length(); idx++) {
+		hash = ((hash ^ (unsigned char) name[idx]) * 16777619UL) & 0xffffffffUL;
+	}
+
+	hash ^= hash >> 16;
+	hash = (hash * 2246822507UL) & 0xffffffffUL;
+	hash ^= hash >> 13;
+	hash = (hash * 3266489909UL) & 0xffffffffUL;
+	hash ^= hash >> 16;
+
+	return (unsigned int) hash;
+}
+
+bool buildPerfectHash(const vector<string>& names, vector<unsigned int>& seeds, vector<size_t>& slots) {
+	// a bucket per name keeps buckets small, so that seeds are found quickly
+	const size_t count = names.size();
+	seeds.assign(max(count, (size_t) 1), 0);
+	slots.assign(count, 0);
+	if (set<string>(names.begin(), names.end()).size() != count) {
+		return false;
+	}
+
+	vector<vector<size_t> > buckets(seeds.size());
+	for (size_t idx = 0; idx < count; idx++) {
+		buckets[hashName(names[idx], 0) % seeds.size()].push_back(idx);
+	}
+
+	// larger buckets are placed first, while most slots are free
+	vector<size_t> order;
+	for (size_t bucket = 0; bucket < buckets.size(); bucket++) {
+		if (!buckets[bucket].empty()) order.push_back(bucket);
+	}
+	stable_sort(order.begin(), order.end(), [&](const size_t a, const size_t b) {
+		return buckets[a].size() > buckets[b].size();
+	});
+
+	const unsigned int max_seed = 1 << 24;
+	vector<bool> taken(count, false);
+	vector<size_t> chosen;
+	for (size_t idx = 0; idx < order.size(); idx++) {
+		const vector<size_t>& bucket = buckets[order[idx]];
+		unsigned int seed = 1;
+		for (; seed <= max_seed; seed++) {
+			chosen.clear();
+			for (size_t name = 0; name < bucket.size(); name++) {
+				const size_t slot = hashName(names[bucket[name]], seed) % count;
+				if (taken[slot] || find(chosen.begin(), chosen.end(), slot) != chosen.end()) break;
+				chosen.push_back(slot);
+			}
+			if (chosen.size() == bucket.size()) break;
+		}
+		if (seed > max_seed) {
+			return false;
+		}
+
+		seeds[order[idx]] = seed;
+		for (size_t name = 0; name < bucket.size(); name++) {
+			taken[chosen[name]] = true;
+			slots[bucket[name]] = chosen[name];
+		}
+	}
+
+	return true;
+}
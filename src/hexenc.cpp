@@ -0,0 +1,442 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+#include "hexenc.h"
+
+#include <cstdlib> // getenv
+#include <cstring> // memcpy
+#include <iostream>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define B2H_X86_KERNELS 1
+#include <immintrin.h>
+#define B2H_TARGET(isa) __attribute__((target(isa)))
+#else
+#define B2H_X86_KERNELS 0
+#endif
+
+using namespace std;
+
+
+enum SimdLevel {
+	SIMD_SCALAR,
+	SIMD_SSE2,
+	SIMD_SSSE3,
+	SIMD_AVX2,
+};
+
+static const char* simd_names[] = {"scalar", "sse2", "ssse3", "avx2"};
+
+
+/** Precomputed text for every possible byte value. */
+struct HexTable {
+	char pair[256][2];  // "NN"
+	char token[256][6]; // "0xNN, "
+
+	HexTable() {
+		const char digits[] = "0123456789abcdef";
+		for (int b = 0; b < 256; b++) {
+			pair[b][0] = digits[b >> 4];
+			pair[b][1] = digits[b & 0x0f];
+
+			memcpy(token[b], "0x", 2);
+			memcpy(token[b] + 2, pair[b], 2);
+			memcpy(token[b] + 4, ", ", 2);
+		}
+	}
+};
+
+static const HexTable hex_table;
+
+
+/** Text lengths for words of `WB` bytes. */
+template<unsigned int WB>
+struct Token {
+	static const unsigned int length = 2 * WB + 4;       // single "0x..., " token
+	static const unsigned int block = 16 / WB * length;  // tokens of a 16 byte block
+	static const unsigned int nvec = block / 16;         // 16 byte vectors per block
+};
+
+
+template<unsigned int WB, bool SWAP>
+static char* encodeScalar(char* out, char* /*out_end*/, const unsigned char* data,
+		const size_t size, const size_t /*readable*/) {
+	const unsigned char* const data_end = data + size;
+	if (WB == 1) {
+		for (; data < data_end; data++) {
+			memcpy(out, hex_table.token[*data], 6);
+			out += 6;
+		}
+		return out;
+	}
+
+	for (; data < data_end; data += WB) {
+		*out++ = '0';
+		*out++ = 'x';
+		for (unsigned int i = 0; i < WB; i++) {
+			memcpy(out, hex_table.pair[data[SWAP ? WB - 1 - i : i]], 2);
+			out += 2;
+		}
+		*out++ = ',';
+		*out++ = ' ';
+	}
+
+	return out;
+}
+
+
+#if B2H_X86_KERNELS
+
+/** Shuffle controls placing the hex digits of a 16 byte block into tokens.
+ *
+ *  The 32 hex digits of a block are held in two registers (bytes 0-7 & 8-15).
+ *  Each 16 byte output vector is assembled by shuffling digits out of both
+ *  registers & merging the constant "0x" & ", " characters.
+ */
+struct ShuffleLayout {
+	unsigned char lo[6][16];
+	unsigned char hi[6][16];
+	unsigned char text[6][16];
+	unsigned char swap[16]; // reverses byte order of words
+
+	explicit ShuffleLayout(const unsigned int wb) {
+		const unsigned int token_length = 2 * wb + 4;
+
+		for (unsigned int pos = 0; pos < 16 / wb * token_length; pos++) {
+			const unsigned int v = pos / 16;
+			const unsigned int i = pos % 16;
+			const unsigned int t = pos / token_length;
+			const unsigned int r = pos % token_length;
+
+			lo[v][i] = 0x80;
+			hi[v][i] = 0x80;
+			text[v][i] = 0;
+			if (r < 2) {
+				text[v][i] = "0x"[r];
+			} else if (r < 2 + 2 * wb) {
+				const unsigned int digit = t * 2 * wb + r - 2;
+				if (digit < 16) lo[v][i] = digit;
+				else hi[v][i] = digit - 16;
+			} else {
+				text[v][i] = ", "[r - 2 - 2 * wb];
+			}
+		}
+
+		for (unsigned int i = 0; i < 16; i++) {
+			swap[i] = i - i % wb + (wb - 1 - i % wb);
+		}
+	}
+};
+
+static const ShuffleLayout layout8(1);
+static const ShuffleLayout layout16(2);
+static const ShuffleLayout layout32(4);
+static const ShuffleLayout layout64(8);
+
+template<unsigned int WB>
+static inline const ShuffleLayout& getLayout() {
+	return WB == 1 ? layout8 : WB == 2 ? layout16 : WB == 4 ? layout32 : layout64;
+}
+
+
+/** Writes the two 20 byte tokens of a 16 byte block of 64 bit words.
+ *
+ *  Each word fills a whole register of digits, so tokens are assembled with
+ *  plain stores instead of shuffles (which would write past the block).
+ */
+B2H_TARGET("sse2")
+static inline void storeTokens64(char* out, const __m128i digits_lo, const __m128i digits_hi) {
+	memcpy(out, "0x", 2);
+	_mm_storeu_si128((__m128i*) (out + 2), digits_lo);
+	memcpy(out + 18, ", 0x", 4);
+	_mm_storeu_si128((__m128i*) (out + 22), digits_hi);
+	memcpy(out + 38, ", ", 2);
+}
+
+
+/* *** SSE2: hex digits computed arithmetically, tokens built by word shuffles *** */
+
+template<unsigned int WB, bool SWAP>
+B2H_TARGET("sse2")
+static inline void blockSSE2(char* out, const unsigned char* data) {
+	__m128i x = _mm_loadu_si128((const __m128i*) data);
+	if (SWAP && WB == 4) {
+		x = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+	} else if (SWAP && WB == 8) {
+		x = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3));
+	}
+	if (SWAP) {
+		x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+	}
+
+	// nibble + '0', plus distance to 'a' for values above 9
+	const __m128i nibble = _mm_set1_epi8(0x0f);
+	const __m128i nine = _mm_set1_epi8(9);
+	const __m128i ascii_0 = _mm_set1_epi8('0');
+	const __m128i alpha = _mm_set1_epi8('a' - '0' - 10);
+	__m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), nibble);
+	__m128i lo = _mm_and_si128(x, nibble);
+	hi = _mm_add_epi8(_mm_add_epi8(hi, ascii_0), _mm_and_si128(_mm_cmpgt_epi8(hi, nine), alpha));
+	lo = _mm_add_epi8(_mm_add_epi8(lo, ascii_0), _mm_and_si128(_mm_cmpgt_epi8(lo, nine), alpha));
+
+	const __m128i digits[2] = {_mm_unpacklo_epi8(hi, lo), _mm_unpackhi_epi8(hi, lo)};
+	const short x0 = '0' | ('x' << 8);
+	const short cs = ',' | (' ' << 8);
+
+	if (WB == 1) {
+		// 16 bit units: "0x", digit pair, ", "
+		const __m128i keep0 = _mm_setr_epi16(0, -1, 0, 0, -1, 0, 0, -1);
+		const __m128i keep1 = _mm_setr_epi16(0, 0, -1, 0, 0, -1, 0, 0);
+		const __m128i keep2 = _mm_setr_epi16(-1, 0, 0, -1, 0, 0, -1, 0);
+		const __m128i text0 = _mm_setr_epi16(x0, 0, cs, x0, 0, cs, x0, 0);
+		const __m128i text1 = _mm_setr_epi16(cs, x0, 0, cs, x0, 0, cs, x0);
+		const __m128i text2 = _mm_setr_epi16(0, cs, x0, 0, cs, x0, 0, cs);
+		for (int d = 0; d < 2; d++) {
+			const __m128i p = digits[d];
+			__m128i v;
+			v = _mm_shuffle_epi32(p, _MM_SHUFFLE(1, 0, 1, 0));
+			v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 0, 0, 0)), _MM_SHUFFLE(2, 0, 0, 1));
+			_mm_storeu_si128((__m128i*) (out + 48 * d), _mm_or_si128(_mm_and_si128(v, keep0), text0));
+			v = _mm_shuffle_epi32(p, _MM_SHUFFLE(2, 2, 1, 1));
+			v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 0, 0)), _MM_SHUFFLE(0, 0, 0, 0));
+			_mm_storeu_si128((__m128i*) (out + 48 * d + 16), _mm_or_si128(_mm_and_si128(v, keep1), text1));
+			v = _mm_shuffle_epi32(p, _MM_SHUFFLE(3, 3, 3, 2));
+			v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 0, 0, 1)), _MM_SHUFFLE(0, 1, 0, 0));
+			_mm_storeu_si128((__m128i*) (out + 48 * d + 32), _mm_or_si128(_mm_and_si128(v, keep2), text2));
+		}
+	} else if (WB == 2) {
+		// 64 bit tokens: "0x", 4 digits, ", "
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i text = _mm_setr_epi16(x0, 0, 0, cs, x0, 0, 0, cs);
+		for (int d = 0; d < 2; d++) {
+			const __m128i a = _mm_slli_epi64(_mm_unpacklo_epi32(digits[d], zero), 16);
+			const __m128i b = _mm_slli_epi64(_mm_unpackhi_epi32(digits[d], zero), 16);
+			_mm_storeu_si128((__m128i*) (out + 32 * d), _mm_or_si128(a, text));
+			_mm_storeu_si128((__m128i*) (out + 32 * d + 16), _mm_or_si128(b, text));
+		}
+	} else if (WB == 8) {
+		// 20 byte tokens: "0x", 16 digits, ", "
+		storeTokens64(out, digits[0], digits[1]);
+	} else {
+		// 12 byte tokens: "0x", 8 digits, ", "
+		char text[32];
+		_mm_storeu_si128((__m128i*) text, digits[0]);
+		_mm_storeu_si128((__m128i*) (text + 16), digits[1]);
+		for (int t = 0; t < 4; t++) {
+			memcpy(out, "0x", 2);
+			memcpy(out + 2, text + 8 * t, 8);
+			memcpy(out + 10, ", ", 2);
+			out += 12;
+		}
+	}
+}
+
+
+/* *** SSSE3: table lookup & token placement with byte shuffles *** */
+
+template<unsigned int WB, bool SWAP>
+B2H_TARGET("ssse3")
+static inline void blockSSSE3(char* out, const unsigned char* data) {
+	const ShuffleLayout& layout = getLayout<WB>();
+
+	__m128i x = _mm_loadu_si128((const __m128i*) data);
+	if (SWAP) {
+		x = _mm_shuffle_epi8(x, _mm_loadu_si128((const __m128i*) layout.swap));
+	}
+
+	const __m128i hex_digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
+			'a', 'b', 'c', 'd', 'e', 'f');
+	const __m128i nibble = _mm_set1_epi8(0x0f);
+	const __m128i hi = _mm_shuffle_epi8(hex_digits, _mm_and_si128(_mm_srli_epi16(x, 4), nibble));
+	const __m128i lo = _mm_shuffle_epi8(hex_digits, _mm_and_si128(x, nibble));
+	const __m128i digits_lo = _mm_unpacklo_epi8(hi, lo);
+	const __m128i digits_hi = _mm_unpackhi_epi8(hi, lo);
+
+	if (WB == 8) {
+		storeTokens64(out, digits_lo, digits_hi);
+		return;
+	}
+
+	for (unsigned int v = 0; v < Token<WB>::nvec; v++) {
+		const __m128i a = _mm_shuffle_epi8(digits_lo, _mm_loadu_si128((const __m128i*) layout.lo[v]));
+		const __m128i b = _mm_shuffle_epi8(digits_hi, _mm_loadu_si128((const __m128i*) layout.hi[v]));
+		const __m128i text = _mm_loadu_si128((const __m128i*) layout.text[v]);
+		_mm_storeu_si128((__m128i*) (out + 16 * v), _mm_or_si128(_mm_or_si128(a, b), text));
+	}
+}
+
+
+/* *** AVX2: two SSSE3 blocks per instruction, one in each 128 bit lane *** */
+
+template<unsigned int WB, bool SWAP>
+B2H_TARGET("avx2")
+static inline void blockAVX2(char* out, const unsigned char* data) {
+	const ShuffleLayout& layout = getLayout<WB>();
+	const unsigned int block_length = Token<WB>::block;
+
+	__m256i x = _mm256_loadu_si256((const __m256i*) data);
+	if (SWAP) {
+		x = _mm256_shuffle_epi8(x, _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) layout.swap)));
+	}
+
+	const __m256i hex_digits = _mm256_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
+			'a', 'b', 'c', 'd', 'e', 'f', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
+			'a', 'b', 'c', 'd', 'e', 'f');
+	const __m256i nibble = _mm256_set1_epi8(0x0f);
+	const __m256i hi = _mm256_shuffle_epi8(hex_digits, _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble));
+	const __m256i lo = _mm256_shuffle_epi8(hex_digits, _mm256_and_si256(x, nibble));
+	const __m256i digits_lo = _mm256_unpacklo_epi8(hi, lo);
+	const __m256i digits_hi = _mm256_unpackhi_epi8(hi, lo);
+
+	if (WB == 8) {
+		storeTokens64(out, _mm256_castsi256_si128(digits_lo), _mm256_castsi256_si128(digits_hi));
+		storeTokens64(out + block_length, _mm256_extracti128_si256(digits_lo, 1),
+				_mm256_extracti128_si256(digits_hi, 1));
+		return;
+	}
+
+	for (unsigned int v = 0; v < Token<WB>::nvec; v++) {
+		const __m256i a = _mm256_shuffle_epi8(digits_lo,
+				_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) layout.lo[v])));
+		const __m256i b = _mm256_shuffle_epi8(digits_hi,
+				_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) layout.hi[v])));
+		const __m256i text = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) layout.text[v]));
+		const __m256i res = _mm256_or_si256(_mm256_or_si256(a, b), text);
+		_mm_storeu_si128((__m128i*) (out + 16 * v), _mm256_castsi256_si128(res));
+		_mm_storeu_si128((__m128i*) (out + block_length + 16 * v), _mm256_extracti128_si256(res, 1));
+	}
+}
+
+
+/** Encodes the remainder of a line that is shorter than a block.
+ *
+ *  If a whole block can be loaded it is encoded in place when the
+ *  destination has room for it, or into a temporary buffer otherwise.
+ *  Near the end of the input the scalar encoder is used.
+ */
+#define B2H_ENCODE_TAIL(block_func) \
+	if (size > 0) { \
+		const size_t tail_length = size / WB * Token<WB>::length; \
+		if (readable < 16) { \
+			out = encodeScalar<WB, SWAP>(out, out_end, data, size, readable); \
+		} else if ((size_t) (out_end - out) >= Token<WB>::block) { \
+			block_func<WB, SWAP>(out, data); \
+			out += tail_length; \
+		} else { \
+			char tail[Token<WB>::block]; \
+			block_func<WB, SWAP>(tail, data); \
+			memcpy(out, tail, tail_length); \
+			out += tail_length; \
+		} \
+	}
+
+template<unsigned int WB, bool SWAP>
+B2H_TARGET("sse2")
+static char* encodeSSE2(char* out, char* out_end, const unsigned char* data, size_t size,
+		size_t readable) {
+	const unsigned int block_length = Token<WB>::block;
+	for (; size >= 16; size -= 16, readable -= 16, data += 16, out += block_length) {
+		blockSSE2<WB, SWAP>(out, data);
+	}
+	B2H_ENCODE_TAIL(blockSSE2)
+
+	return out;
+}
+
+template<unsigned int WB, bool SWAP>
+B2H_TARGET("ssse3")
+static char* encodeSSSE3(char* out, char* out_end, const unsigned char* data, size_t size,
+		size_t readable) {
+	const unsigned int block_length = Token<WB>::block;
+	for (; size >= 16; size -= 16, readable -= 16, data += 16, out += block_length) {
+		blockSSSE3<WB, SWAP>(out, data);
+	}
+	B2H_ENCODE_TAIL(blockSSSE3)
+
+	return out;
+}
+
+template<unsigned int WB, bool SWAP>
+B2H_TARGET("avx2")
+static char* encodeAVX2(char* out, char* out_end, const unsigned char* data, size_t size,
+		size_t readable) {
+	const unsigned int block_length = Token<WB>::block;
+	for (; size >= 32; size -= 32, readable -= 32, data += 32, out += 2 * block_length) {
+		blockAVX2<WB, SWAP>(out, data);
+	}
+	for (; size >= 16; size -= 16, readable -= 16, data += 16, out += block_length) {
+		blockSSSE3<WB, SWAP>(out, data);
+	}
+	B2H_ENCODE_TAIL(blockSSSE3)
+
+	return out;
+}
+
+#undef B2H_ENCODE_TAIL
+
+#endif /* B2H_X86_KERNELS */
+
+
+/** Retrieves highest instruction set supported by the CPU. */
+static int detectSimdLevel() {
+	int level = SIMD_SCALAR;
+
+#if B2H_X86_KERNELS
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("sse2")) level = SIMD_SSE2;
+	if (level == SIMD_SSE2 && __builtin_cpu_supports("ssse3")) level = SIMD_SSSE3;
+	if (level == SIMD_SSSE3 && __builtin_cpu_supports("avx2")) level = SIMD_AVX2;
+#endif
+
+	const char* requested = getenv("BIN2HEADER_SIMD");
+	if (requested != NULL) {
+		int idx;
+		for (idx = 0; idx < 4; idx++) {
+			if (string(simd_names[idx]) == requested) break;
+		}
+
+		if (idx == 4) {
+			cout << "\nWARNING: Unknown BIN2HEADER_SIMD value \"" << requested << "\", ignoring\n" << endl;
+		} else if (idx < level) {
+			level = idx;
+		}
+	}
+
+	return level;
+}
+
+static int getSimdLevel() {
+	static const int level = detectSimdLevel();
+	return level;
+}
+
+
+#if B2H_X86_KERNELS
+#define B2H_ENCODERS(wb, swap) { \
+		encodeScalar<wb, swap>, encodeSSE2<wb, swap>, encodeSSSE3<wb, swap>, encodeAVX2<wb, swap>}
+#else
+#define B2H_ENCODERS(wb, swap) { \
+		encodeScalar<wb, swap>, encodeScalar<wb, swap>, encodeScalar<wb, swap>, encodeScalar<wb, swap>}
+#endif
+
+HexEncoder getHexEncoder(const unsigned int wordbytes, const bool swap) {
+	// indexed by [word length][swap][instruction set]
+	static const HexEncoder encoders[4][2][4] = {
+		{B2H_ENCODERS(1, false), B2H_ENCODERS(1, false)},
+		{B2H_ENCODERS(2, false), B2H_ENCODERS(2, true)},
+		{B2H_ENCODERS(4, false), B2H_ENCODERS(4, true)},
+		{B2H_ENCODERS(8, false), B2H_ENCODERS(8, true)},
+	};
+
+	const int idx = wordbytes == 8 ? 3 : wordbytes == 4 ? 2 : wordbytes == 2 ? 1 : 0;
+	return encoders[idx][swap ? 1 : 0][getSimdLevel()];
+}
+
+#undef B2H_ENCODERS
+
+string getHexEncoderName() {
+	return simd_names[getSimdLevel()];
+}
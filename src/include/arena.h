@@ -0,0 +1,59 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// buffer memory
+
+#ifndef B2H_ARENA_H_
+#define B2H_ARENA_H_
+
+#include <cstddef> // size_t
+
+
+/** Block of memory that buffers are taken from, allocated once per conversion.
+ *
+ *  On POSIX systems pages are backed by physical memory only once they are
+ *  touched, so the block can be sized for the largest number of buffers that
+ *  may ever be in use without costing memory up front.
+ */
+class BufferArena {
+public:
+	BufferArena();
+	~BufferArena();
+
+	/** Allocates the block, releasing any previous one.
+	 *
+	 *  @tparam size_t size
+	 *      Number of bytes.
+	 *  @tparam bool huge
+	 *      Requests transparent huge pages where supported.
+	 *  @return
+	 *      `false` if memory could not be allocated.
+	 */
+	bool allocate(const size_t size, const bool huge);
+
+	/** Frees the block. */
+	void free();
+
+	/** Takes memory from the block.
+	 *
+	 *  @tparam size_t size
+	 *      Number of bytes.
+	 *  @return
+	 *      Pointer to memory or `NULL` if the block is exhausted.
+	 */
+	char* take(const size_t size);
+
+	/** Retrieves size of the block (in bytes). */
+	size_t capacity() const { return length; }
+
+private:
+	char* base;
+	size_t length;
+	size_t used;
+};
+
+
+#endif /* B2H_ARENA_H_ */
@@ -0,0 +1,55 @@
+
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// output cache shared by processes & workspaces
+
+#ifndef B2H_CACHE_H_
+#define B2H_CACHE_H_
+
+#include <string>
+#include <vector>
+
+
+/** Copies cached output files to their paths.
+ *
+ *  Files are cloned where the file system supports it (Linux) & copied
+ *  otherwise. The entry is marked as recently used.
+ *
+ *  @tparam string dir
+ *      Cache directory.
+ *  @tparam string key
+ *      Key of the entry.
+ *  @tparam vector<string> paths
+ *      Output files in the order they were stored.
+ *  @return
+ *      `false` if the entry does not exist or could not be copied.
+ */
+extern bool cacheFetch(const std::string dir, const std::string key, const std::vector<std::string> paths);
+
+/** Stores output files in the cache.
+ *
+ *  The entry is written to a temporary directory & renamed, so that other
+ *  processes never see incomplete entries. The size of the cache is
+ *  scanned by the first call of the process & then grown by each stored
+ *  entry. Once it exceeds the limit, the cache is scanned again & least
+ *  recently used entries are removed until it is 1/8 below the limit.
+ *
+ *  @tparam string dir
+ *      Cache directory (created if missing).
+ *  @tparam string key
+ *      Key of the entry.
+ *  @tparam vector<string> paths
+ *      Output files to store.
+ *  @tparam unsigned long long max_size
+ *      Size limit of the cache in bytes (0 = unlimited).
+ *  @return
+ *      `false` if the entry could not be written.
+ */
+extern bool cacheStore(const std::string dir, const std::string key, const std::vector<std::string> paths,
+		const unsigned long long max_size);
+
+#endif /* B2H_CACHE_H_ */
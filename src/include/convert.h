@@ -9,6 +9,7 @@
 #define B2H_CONVERT_H_
 
 #include <string>
+#include <vector>
 
 
 #define len(a) (sizeof(a)/sizeof(*a))
@@ -36,7 +37,7 @@ extern void setShowDataContent(const bool dc);
 
 /** Sets data type length.
  *
- *  Supported values are 8, 16, & 32.
+ *  Supported values are 8, 16, 32, & 64.
  *
  *  @tparam int bl
  *      Bit length.
@@ -59,9 +60,123 @@ extern void setReadLength(const unsigned long lgt);
 
 /** Changes output bytes to big endian.
  *
- *  16 & 32 bit data types only.
+ *  16, 32 & 64 bit data types only.
+ *
+ *  @tparam bool sw
+ *      `true` to swap bytes, `false` keeps native byte order.
+ */
+extern void setSwapEndianess(const bool sw=true);
+
+/** Sets number of threads used to format data.
+ *
+ *  @tparam int j
+ *      Number of threads (0 = one per CPU core).
+ */
+extern void setJobs(const unsigned int j);
+
+/** Sets number of chunks read ahead of formatting.
+ *
+ *  @tparam int depth
+ *      Number of chunks (0 = read when needed).
+ */
+extern void setReadAhead(const unsigned int depth);
+
+/** Enables transparent huge pages for read buffers.
+ *
+ *  @tparam bool hp
+ *      `true` to request huge pages (Linux only).
+ */
+extern void setHugePages(const bool hp);
+
+/** Sets representation of the data.
+ *
+ *  @tparam string newFormat
+ *      "array" for a list of numbers, "string" for string literals, "embed"
+ *      for an #embed directive, "incbin" for an assembler .incbin directive
+ *      or "elf64"/"elf32" for an ELF relocatable object.
+ *  @return
+ *      `false` if format is unknown.
+ */
+extern bool setOutputFormat(const std::string newFormat);
+
+/** Sets whether headers using #embed also contain the data as an array.
+ *
+ *  @tparam bool fb
+ *      `true` to support compilers without #embed.
+ */
+extern void setEmbedFallback(const bool fb);
+
+/** Sets whether data is defined in a separate source instead of the header.
+ *
+ *  @tparam bool sp
+ *      `true` to write a header with declarations & a C source (C++ with
+ *      std::vector) defining the data.
+ */
+extern void setSplitOutput(const bool sp);
+
+/** Sets maximum number of bytes defined per data source.
+ *
+ *  @tparam long long sz
+ *      Shard size (0 = all data in one file).
+ */
+extern void setShardSize(const unsigned long long sz);
+
+/** Sets whether existing output written from the same data & options is kept.
+ *
+ *  @tparam bool sk
+ *      `true` to write a fingerprint of the data & options to the first line
+ *      of the header & leave output untouched if it has the same fingerprint.
+ */
+extern void setSkipUnchanged(const bool sk);
+
+/** Sets directory where outputs are cached between builds.
+ *
+ *  Outputs are stored under a key hashed from the input data, all options
+ *  & the program version, & copied from the cache instead of converting
+ *  when the key is found. The directory can be shared by several processes.
+ *
+ *  @tparam string dir
+ *      Cache directory (empty to disable caching).
+ *  @tparam string version
+ *      Program version.
+ */
+extern void setCacheDir(const std::string dir, const std::string version);
+
+/** Sets size limit of the cache.
+ *
+ *  @tparam unsigned long long sz
+ *      Number of bytes kept, least recently used outputs are removed first
+ *      (0 = unlimited).
+ */
+extern void setCacheSize(const unsigned long long sz);
+
+/** Sets alignment of the data.
+ *
+ *  @tparam int al
+ *      Alignment in bytes (0 = natural alignment of the data type).
+ *  @return
+ *      `false` if alignment is not a power of two.
+ */
+extern bool setDataAlignment(const unsigned int al);
+
+/** Sets linker section holding the data.
+ *
+ *  @tparam string sec
+ *      Section name (empty = default read-only data section).
+ *  @return
+ *      `false` if name contains quotes, backslashes or whitespace.
+ */
+extern bool setDataSection(const std::string sec);
+
+/** Sets accessor referring to the data without copying it.
+ *
+ *  @tparam string newView
+ *      "none", "span" for a C++20 std::span, "string_view" for a C++17
+ *      std::string_view or "struct" for a C struct with pointer & size.
+ *  @return
+ *      `false` if view is unknown.
  */
-extern void setSwapEndianess();
+extern bool setDataView(const std::string newView);
 
 /** Sets end of line character.
  *
@@ -84,5 +199,43 @@ extern void setEol(const std::string newEol);
 extern int convert(const std::string fin, std::string fout="", std::string hname="",
 		const bool stdvector=false);
 
+/** Reads data from several input files & writes a header for each.
+ *
+ *  Files are converted concurrently by the number of threads set with
+ *  `setJobs`. Only errors & warnings are shown for each file, followed by
+ *  a summary.
+ *
+ *  @tparam vector<string> files
+ *      Paths to files to be read.
+ *  @tparam string outdir
+ *      Directory where headers are written (default: next to each input file).
+ *  @tparam stdvector
+ *      Flag to additionally store data in C++ std::vector (default: `false`).
+ *  @tparam string index
+ *      Header including all headers & finding their data by name with a
+ *      minimal perfect hash, written if all files were converted (default:
+ *      none).
+ *  @return
+ *      0 if all files were converted, otherwise error code of the first failed file.
+ */
+extern int convertBatch(const std::vector<std::string> files, const std::string outdir="",
+		const bool stdvector=false, const std::string index="");
+
+/** Reads all files below a directory & writes a header bundling them.
+ *
+ *  The files are stored in one array, in order of their paths relative to
+ *  the directory. An index sorted by path lists the offset & size of each
+ *  file, & a function generated with it finds files by binary search.
+ *  Directories are listed & files are formatted by the number of threads
+ *  set with `setJobs`.
+ *
+ *  @tparam string dir
+ *      Directory to be read.
+ *  @tparam string fout
+ *      Path to file to be written (default: `dir` + ".h").
+ *  @tparam string hname
+ *      Text to be used for header definition & array variable name (default: name of `dir`).
+ */
+extern int convertBundle(const std::string dir, std::string fout="", std::string hname="");
 
 #endif /* B2H_CONVERT_H_ */
@@ -0,0 +1,87 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// ELF relocatable objects
+
+#ifndef B2H_ELF_H_
+#define B2H_ELF_H_
+
+#include <string>
+
+
+/** Layout of an ELF relocatable object holding a block of data.
+ *
+ *  The data is placed in a `.rodata` (or named) section between the text
+ *  returned by `head` & `tail`, so that it can be copied to the object as it
+ *  is read.
+ *  The object defines the symbols `<symbol>` (the data), `<symbol>_end`
+ *  (end of the data) & `<symbol>_size` (64 bit number of bytes).
+ */
+class ElfObject {
+public:
+	/** Sets up the layout for the architecture of the system.
+	 *
+	 *  @tparam int bits
+	 *      Class of object (32 or 64).
+	 *  @tparam string symbol
+	 *      Symbol name of the data.
+	 *  @tparam long long size
+	 *      Number of data bytes.
+	 *  @tparam int align
+	 *      Alignment of the data (0 = 16 bytes).
+	 *  @tparam string sect
+	 *      Name of the section holding the data (empty = `.rodata`).
+	 */
+	ElfObject(const unsigned int bits, const std::string symbol, const unsigned long long size,
+			const unsigned int align=0, const std::string sect="");
+
+	/** Checks if objects can be created for the architecture of the system
+	 *  & the data fits the object class.
+	 */
+	bool isSupported() const { return machine != 0 && (bits == 64 || fileSize() <= 0xffffffffULL); }
+
+	/** Retrieves text preceding the data (ELF header & padding). */
+	std::string head() const;
+
+	/** Retrieves text following the data (size, symbols & section headers). */
+	std::string tail() const;
+
+	/** Retrieves size of the complete object file (in bytes). */
+	unsigned long long fileSize() const { return shdr_offset + 6 * shdr_size; }
+
+private:
+	const unsigned int bits;
+	const std::string symbol;
+	const unsigned long long size;
+	const unsigned int align;
+	const std::string section;
+	unsigned int machine;
+	unsigned int flags;
+
+	unsigned int ehdr_size;
+	unsigned int shdr_size;
+	unsigned int sym_size;
+	unsigned long long data_offset;
+	unsigned long long size_offset; // of `<symbol>_size` in data section
+	unsigned long long symtab_offset;
+	unsigned long long strtab_offset;
+	unsigned long long shstrtab_offset;
+	unsigned long long shdr_offset;
+
+	std::string strtab;
+	std::string shstrtab;
+
+	void putWord(std::string& text, const unsigned long long value) const;
+	void putSection(std::string& text, const unsigned int name, const unsigned int type,
+			const unsigned long long flags, const unsigned long long offset, const unsigned long long size,
+			const unsigned int link, const unsigned int info, const unsigned int align,
+			const unsigned int entsize) const;
+	void putSymbol(std::string& text, const unsigned int name, const unsigned char info,
+			const unsigned int shndx, const unsigned long long value, const unsigned long long size) const;
+};
+
+
+#endif /* B2H_ELF_H_ */
@@ -0,0 +1,100 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// array body text formatting
+
+#ifndef B2H_FORMAT_H_
+#define B2H_FORMAT_H_
+
+#include <cstddef> // size_t
+#include <string>
+
+
+/** Layout of the lines written to the array body. */
+struct LineFormat {
+	unsigned int wordbytes; // bytes packed into each word (1/2/4/8)
+	unsigned int nbData;    // number of words per line
+	bool swap;              // reverse byte order of packed words
+	bool showDataContent;   // append data content comment to each line
+	std::string eol;        // end of line character(s)
+	bool literal;           // write bytes as string literals instead of numbers
+
+	/** Number of input bytes represented by one full line. */
+	unsigned int lineBytes() const { return nbData * wordbytes; }
+
+	/** Checks if formatted length depends only on the number of bytes. */
+	bool fixedSize() const { return !literal; }
+};
+
+/** Converts non-printable characters to ".".
+ *
+ *  @tparam char c
+ *      Character to evaluate.
+ *  @return
+ *      Same character or "." non-printable.
+ */
+extern char toPrintableChar(char c);
+
+/** Calculates length of text produced by `formatLines`.
+ *
+ *  For string literals, whose escapes depend on the data, this is the
+ *  largest possible length.
+ *
+ *  @tparam long long size
+ *      Number of input bytes.
+ *  @tparam LineFormat fmt
+ *      Line layout.
+ *  @tparam bool last
+ *      `true` if data ends with the final line of the array.
+ *  @return
+ *      Number of characters.
+ */
+extern unsigned long long formattedSize(const unsigned long long size, const LineFormat& fmt,
+		const bool last);
+
+/** Formats input bytes into array body lines.
+ *
+ *  Data must begin on a line boundary. Unless `last` is set, a final line
+ *  shorter than the line length keeps the separator after its last word, so
+ *  that following data begins on a new line.
+ *
+ *  @tparam char* out
+ *      Destination with room for at least `formattedSize` characters.
+ *  @tparam char* out_end
+ *      End of writable destination. Characters between the formatted text &
+ *      this limit may be overwritten with scratch data.
+ *  @tparam char* data
+ *      Input bytes.
+ *  @tparam size_t size
+ *      Number of input bytes (multiple of word length).
+ *  @tparam LineFormat fmt
+ *      Line layout.
+ *  @tparam bool last
+ *      `true` if data ends with the final line of the array.
+ *  @return
+ *      Number of characters written.
+ */
+extern size_t formatLines(char* out, char* out_end, const unsigned char* data,
+		const size_t size, const LineFormat& fmt, const bool last);
+
+/** Formats input bytes & appends the text to a buffer.
+ *
+ *  @tparam string buf
+ *      Buffer to append to (its capacity is reused between calls).
+ *  @tparam char* data
+ *      Input bytes.
+ *  @tparam size_t size
+ *      Number of input bytes.
+ *  @tparam LineFormat fmt
+ *      Line layout.
+ *  @tparam bool last
+ *      `true` if data ends with the final line of the array.
+ */
+extern void formatLines(std::string& buf, const unsigned char* data, const size_t size,
+		const LineFormat& fmt, const bool last);
+
+
+#endif /* B2H_FORMAT_H_ */
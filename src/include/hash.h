@@ -0,0 +1,87 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// content fingerprints & name lookup tables
+
+#ifndef B2H_HASH_H_
+#define B2H_HASH_H_
+
+#include <cstddef> // size_t
+#include <string>
+#include <vector>
+
+
+/** 64 bit XXH64 hash of data passed in any number of parts.
+ *
+ *  Not suited for security purposes, but processes data at about the speed
+ *  of memory, so that hashing costs little compared to reading the data.
+ */
+class Hash64 {
+public:
+	/** Starts a hash.
+	 *
+	 *  @tparam long long seed
+	 *      Initial value.
+	 */
+	Hash64(const unsigned long long seed=0);
+
+	/** Adds data to the hash.
+	 *
+	 *  @tparam char* data
+	 *      Data to be added.
+	 *  @tparam size_t size
+	 *      Number of bytes.
+	 */
+	void update(const unsigned char* data, size_t size);
+
+	/** Adds text to the hash. */
+	void update(const std::string text) { update((const unsigned char*) text.data(), text.length()); }
+
+	/** Retrieves hash of all data added so far. */
+	unsigned long long digest() const;
+
+private:
+	unsigned long long acc[4];
+	unsigned char buffer[32]; // incomplete stripe
+	size_t buffered;
+	unsigned long long total;
+};
+
+
+/** 32 bit hash of a name, as computed by generated lookup functions.
+ *
+ *  FNV-1a followed by the MurmurHash3 finalizer, so that each seed gives
+ *  an independent distribution.
+ *
+ *  @tparam string name
+ *      Name to be hashed.
+ *  @tparam int seed
+ *      Selects the hash function.
+ *  @return
+ *      Hash value.
+ */
+extern unsigned int hashName(const std::string name, const unsigned int seed);
+
+/** Builds a minimal perfect hash over a set of names.
+ *
+ *  Names are distributed to buckets by `hashName(name, 0) % seeds.size()`
+ *  & each bucket gets the seed that places its names in free slots by
+ *  `hashName(name, seed) % names.size()`, so that each name has a slot
+ *  of its own.
+ *
+ *  @tparam vector<string> names
+ *      Distinct names.
+ *  @tparam vector<int> seeds
+ *      Set to the seed of each bucket.
+ *  @tparam vector<size_t> slots
+ *      Set to the slot of each name.
+ *  @return
+ *      `false` if names are not distinct or no seed was found for a bucket.
+ */
+extern bool buildPerfectHash(const std::vector<std::string>& names, std::vector<unsigned int>& seeds,
+		std::vector<size_t>& slots);
+
+#endif /* B2H_HASH_H_ */
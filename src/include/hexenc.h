@@ -0,0 +1,61 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// byte to hex text encoding kernels
+
+#ifndef B2H_HEXENC_H_
+#define B2H_HEXENC_H_
+
+#include <cstddef> // size_t
+#include <string>
+
+
+/** Encodes packed words as "0x..., " text tokens.
+ *
+ *  Every word is followed by the ", " separator.
+ *
+ *  @tparam char* out
+ *      Destination text.
+ *  @tparam char* out_end
+ *      End of writable destination. Vector kernels may store whole registers
+ *      past the encoded text (up to this limit) to be overwritten later.
+ *  @tparam char* data
+ *      Input bytes.
+ *  @tparam size_t size
+ *      Number of bytes to encode (multiple of word length).
+ *  @tparam size_t readable
+ *      Number of bytes that may be read from `data` (at least `size`).
+ *      Vector kernels use this to load whole registers past `size`.
+ *  @return
+ *      End of written text.
+ */
+typedef char* (*HexEncoder)(char* out, char* out_end, const unsigned char* data,
+		const size_t size, const size_t readable);
+
+/** Retrieves the fastest encoder supported by the CPU.
+ *
+ *  CPU features are detected once on first use. Setting the environment
+ *  variable `BIN2HEADER_SIMD` to "scalar", "sse2", "ssse3" or "avx2" limits
+ *  the instruction set that can be selected.
+ *
+ *  @tparam int wordbytes
+ *      Bytes packed into each word (1/2/4/8).
+ *  @tparam bool swap
+ *      Reverse byte order of packed words.
+ *  @return
+ *      Encoder function.
+ */
+extern HexEncoder getHexEncoder(const unsigned int wordbytes, const bool swap);
+
+/** Retrieves name of the instruction set used by encoders.
+ *
+ *  @return
+ *      "scalar", "sse2", "ssse3" or "avx2".
+ */
+extern std::string getHexEncoderName();
+
+
+#endif /* B2H_HEXENC_H_ */
@@ -0,0 +1,123 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// input file access
+
+#ifndef B2H_INPUT_H_
+#define B2H_INPUT_H_
+
+#include <cstddef> // size_t
+#include <fstream>
+#include <istream>
+#include <string>
+
+
+/** Sequential reader for a window of an input file.
+ *
+ *  Regular files are memory mapped where supported so that chunks can be
+ *  handed to the formatter without being copied. Other files are read with
+ *  a stream into a caller supplied buffer. Standard input & other files that
+ *  cannot seek are read as a stream of unknown size.
+ */
+class InputFile {
+public:
+	InputFile();
+	~InputFile();
+
+	/** Opens a file for reading.
+	 *
+	 *  @tparam string path
+	 *      Path to file to be read or `-` for standard input.
+	 *  @return
+	 *      `true` if file could be opened.
+	 */
+	bool open(const std::string path);
+
+	/** Closes the file & releases any mapping. */
+	void close();
+
+	/** Retrieves the size of the opened file (in bytes). */
+	unsigned long long size() const { return file_size; }
+
+	/** Checks if the size of the opened file is known before reading. */
+	bool hasSize() const { return sized; }
+
+	/** Selects the range of the file to be read.
+	 *
+	 *  @tparam long long offset
+	 *      Position of first byte to read.
+	 *  @tparam long long length
+	 *      Number of bytes to read.
+	 *  @return
+	 *      `false` if the input ends before `offset`.
+	 */
+	bool select(const unsigned long long offset, const unsigned long long length);
+
+	/** Checks if the selected range is memory mapped. */
+	bool isMapped() const { return map != NULL; }
+
+	/** Reads the next chunk of the selected range.
+	 *
+	 *  @tparam char* buffer
+	 *      Buffer for streamed reads (at least `size` bytes). Not used if the
+	 *      file is memory mapped.
+	 *  @tparam size_t size
+	 *      Number of bytes to read.
+	 *  @return
+	 *      Pointer to chunk data or `NULL` if the requested number of bytes
+	 *      could not be read. Mapped data stays valid until released, streamed
+	 *      data until `buffer` is reused.
+	 */
+	const unsigned char* read(char* buffer, const size_t size);
+
+	/** Reads up to a number of bytes, stopping early at the end of input.
+	 *
+	 *  @tparam char* buffer
+	 *      Buffer to read into (at least `size` bytes).
+	 *  @tparam size_t size
+	 *      Maximum number of bytes to read.
+	 *  @return
+	 *      Number of bytes read.
+	 */
+	size_t readSome(char* buffer, const size_t size);
+
+	/** Asks the system to page in data following the read position.
+	 *
+	 *  Only has an effect for memory mapped files.
+	 *
+	 *  @tparam size_t size
+	 *      Number of bytes to fetch ahead.
+	 */
+	void prefetch(const size_t size);
+
+	/** Notifies that data read before a position is no longer needed.
+	 *
+	 *  @tparam char* end
+	 *      End of consumed data, as returned by `read`.
+	 */
+	void release(const unsigned char* end);
+
+private:
+	std::string path;
+	unsigned long long file_size;
+	bool sized;
+
+	// memory mapped access
+	unsigned char* map;
+	size_t map_length;
+	size_t map_pos;      // read position within mapping
+	size_t map_released; // pages before this position have been released
+
+	// streamed access
+	std::ifstream ifs;
+	std::istream* stream; // `ifs` or standard input
+
+	bool mapRange(const unsigned long long offset, const unsigned long long length);
+	void unmap();
+};
+
+
+#endif /* B2H_INPUT_H_ */
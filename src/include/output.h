@@ -0,0 +1,122 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// output file access
+
+#ifndef B2H_OUTPUT_H_
+#define B2H_OUTPUT_H_
+
+#include <atomic>
+#include <cstddef> // size_t
+#include <cstdio> // FILE
+#include <string>
+
+
+/** Writer for the generated header.
+ *
+ *  Text is appended sequentially, or written at known positions by several
+ *  threads when the output is a regular file on a POSIX system.
+ */
+class OutputFile {
+public:
+	OutputFile();
+	~OutputFile();
+
+	/** Opens a file for writing.
+	 *
+	 *  Existing contents are kept until `reserve` is called, so that a job
+	 *  that cannot complete leaves the previous output untouched.
+	 *
+	 *  @tparam string path
+	 *      Path to file to be written or `-` for standard output.
+	 *  @return
+	 *      `true` if file could be opened.
+	 */
+	bool open(const std::string path);
+
+	/** Closes the file. */
+	void close();
+
+	/** Checks for available disk space, discards previous contents &
+	 *  allocates space for the complete output.
+	 *
+	 *  @tparam long long size
+	 *      Final size of the output (in bytes).
+	 *  @return
+	 *      0 on success or error code (e.g. `ENOSPC`).
+	 */
+	int reserve(const unsigned long long size);
+
+	/** Appends data to the end of the written output.
+	 *
+	 *  @tparam char* data
+	 *      Data to be written.
+	 *  @tparam size_t size
+	 *      Number of bytes.
+	 *  @return
+	 *      `false` if an error occurred.
+	 */
+	bool write(const char* data, const size_t size);
+
+	/** Appends text to the end of the written output.
+	 *
+	 *  @tparam string text
+	 *      Text to be written.
+	 *  @return
+	 *      `false` if an error occurred.
+	 */
+	bool write(const std::string& text) { return write(text.data(), text.size()); }
+
+	/** Writes data at a fixed position (safe to call from several threads).
+	 *
+	 *  @tparam long long pos
+	 *      Position in file.
+	 *  @tparam char* data
+	 *      Data to be written.
+	 *  @tparam size_t size
+	 *      Number of bytes.
+	 *  @return
+	 *      `false` if an error occurred.
+	 */
+	bool writeAt(const unsigned long long pos, const char* data, const size_t size);
+
+	/** Moves the append position forward past data written with `writeAt`.
+	 *
+	 *  @tparam long long size
+	 *      Number of bytes.
+	 */
+	void skip(const unsigned long long size) { pos += size; }
+
+	/** Checks if `writeAt` is supported for the opened file. */
+	bool isPositional() const { return positional; }
+
+	/** Retrieves current append position. */
+	unsigned long long tell() const { return pos; }
+
+	/** Retrieves error code of first failed operation (0 if none). */
+	int error() const { return err.load(); }
+
+	/** Cuts file at current append position, e.g. after cancelling a job. */
+	void truncate();
+
+private:
+	unsigned long long pos;
+	bool positional;
+	bool reserved;
+	std::atomic<int> err;
+
+#ifdef __WIN32__
+	FILE* file;
+	std::string path;
+#else
+	int fd;
+#endif
+
+	void fail(const int code);
+};
+
+
+#endif /* B2H_OUTPUT_H_ */
@@ -9,6 +9,7 @@
 #define B2H_PATHS_H_
 
 #include <string>
+#include <vector>
 
 
 /** Normalizes the path node separators for the current system.
@@ -49,5 +50,55 @@ extern std::string getBaseName(std::string path);
  */
 extern std::string getDirName(std::string path);
 
+/** Resolves path to an absolute path without symbolic links.
+ *
+ *  @tparam string path
+ *      Path to an existing file or directory.
+ *  @return
+ *      Absolute path or empty string if path could not be resolved.
+ */
+extern std::string getAbsolutePath(const std::string path);
+
+/** Retrieves path relative to a directory.
+ *
+ *  @tparam string path
+ *      Path to an existing file.
+ *  @tparam string dir
+ *      Existing directory that result is relative to.
+ *  @return
+ *      Relative path, absolute path if there is none (e.g. on another drive)
+ *      or empty string if paths could not be resolved.
+ */
+extern std::string getRelativePath(const std::string path, const std::string dir);
+
+/** Lists names of the entries in a directory.
+ *
+ *  @tparam string path
+ *      Directory to be listed.
+ *  @return
+ *      Names without "." & ".." (empty if directory cannot be read).
+ */
+extern std::vector<std::string> listDirectory(const std::string path);
+
+/** File found in a directory tree. */
+struct TreeFile {
+	std::string path;        // relative to the tree root, with "/" delimeters
+	unsigned long long size; // number of bytes
+};
+
+/** Finds all regular files below a directory.
+ *
+ *  Directories of each level are listed concurrently. Symbolic links to
+ *  files are followed, links to directories are not.
+ *
+ *  @tparam string dir
+ *      Root of the tree.
+ *  @tparam int jobs
+ *      Number of threads listing directories.
+ *  @return
+ *      Files in no particular order.
+ */
+extern std::vector<TreeFile> findFiles(const std::string dir, const unsigned int jobs);
+
 
 #endif /* B2H_PATHS_H_ */
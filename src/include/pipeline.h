@@ -0,0 +1,104 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// chunk formatting & ordered output
+
+#ifndef B2H_PIPELINE_H_
+#define B2H_PIPELINE_H_
+
+#include "format.h"
+#include "output.h"
+#include "reader.h"
+#include "threads.h"
+
+#include <string>
+#include <vector>
+
+
+/** Retrieves number of threads the system can run concurrently. */
+extern unsigned int getHardwareThreads();
+
+
+/** Formats chunks of input data & writes them to the output in order.
+ *
+ *  With more than one job, chunks are formatted on worker threads. If the
+ *  output supports positional writes, each worker writes its text directly
+ *  at the offset of the chunk. Otherwise the calling thread writes formatted
+ *  text in input order. With a single job each chunk is formatted & written
+ *  as soon as it is submitted.
+ */
+class ChunkPipeline {
+public:
+	/** Starts worker threads.
+	 *
+	 *  @tparam OutputFile out
+	 *      File that formatted text is written to (at its append position).
+	 *  @tparam ChunkReader reader
+	 *      Source of chunks, notified when chunk data is no longer needed.
+	 *  @tparam LineFormat fmt
+	 *      Line layout.
+	 *  @tparam int jobs
+	 *      Number of worker threads (1 formats on calling thread).
+	 */
+	ChunkPipeline(OutputFile& out, ChunkReader& reader, const LineFormat& fmt,
+			const unsigned int jobs);
+
+	/** Stops worker threads. */
+	~ChunkPipeline();
+
+	/** Retrieves maximum number of chunks queued before the oldest is written.
+	 *
+	 *  @tparam int jobs
+	 *      Number of worker threads.
+	 */
+	static unsigned int capacity(const unsigned int jobs);
+
+	/** Queues the next chunk for formatting.
+	 *
+	 *  Waits until a slot is available, writing completed chunks if needed.
+	 *
+	 *  @tparam Chunk chunk
+	 *      Chunk from `reader` (released once it is written).
+	 */
+	void submit(const ChunkReader::Chunk& chunk);
+
+	/** Writes all queued chunks, waiting for them to be formatted. */
+	void finish();
+
+private:
+	struct Slot {
+		ChunkReader::Chunk chunk;
+		bool ready; // formatted (& written if positional)
+		unsigned long long offset; // output position of formatted text
+		std::string text;
+	};
+
+	OutputFile& out;
+	ChunkReader& reader;
+	const LineFormat fmt;
+	bool positional; // workers write their own text
+	unsigned long long next_offset; // output position of next submitted chunk
+
+	std::vector<Slot> slots;
+	unsigned long long submitted; // number of chunks queued
+	unsigned long long formatting; // number of chunks taken by workers
+	unsigned long long written; // number of chunks written
+
+#if B2H_THREADS
+	std::vector<std::thread> workers;
+	std::mutex mutex;
+	std::condition_variable work_cond;
+	std::condition_variable done_cond;
+	bool stopping;
+
+	void work();
+#endif
+
+	void writeNext();
+};
+
+
+#endif /* B2H_PIPELINE_H_ */
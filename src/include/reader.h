@@ -0,0 +1,125 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// chunked input & read-ahead
+
+#ifndef B2H_READER_H_
+#define B2H_READER_H_
+
+#include "arena.h"
+#include "input.h"
+#include "threads.h"
+
+#include <cstddef> // size_t
+#include <deque>
+#include <vector>
+
+
+/** Splits the selected range of an input file into chunks of whole lines.
+ *
+ *  Streamed input is read on a background thread that stays a number of
+ *  chunks ahead of the consumer, so that reading overlaps formatting. Buffers
+ *  are taken from an arena sized for all chunks that can be in use at once &
+ *  reused as chunks are released. Memory mapped input is handed out directly
+ *  & the kernel is asked to fetch pages ahead instead.
+ */
+class ChunkReader {
+public:
+	struct Chunk {
+		const unsigned char* data;
+		size_t size;
+		bool last; // chunk ends the array
+	};
+
+	/** Starts reading the selected range of the input.
+	 *
+	 *  @tparam InputFile input
+	 *      File with range already selected.
+	 *  @tparam int wordbytes
+	 *      Size of a data word (bytes of an incomplete final word are omitted).
+	 *  @tparam size_t chunk_size
+	 *      Maximum number of bytes in a chunk (multiple of `wordbytes`).
+	 *  @tparam long long length
+	 *      Number of bytes in range. For input without a known size, maximum
+	 *      number of bytes to read (0 = all).
+	 *  @tparam int depth
+	 *      Number of chunks to read ahead (0 reads on the calling thread).
+	 *  @tparam int held
+	 *      Maximum number of chunks the consumer holds before releasing them.
+	 *  @tparam bool huge_pages
+	 *      Requests transparent huge pages for chunk buffers.
+	 */
+	ChunkReader(InputFile& input, const unsigned int wordbytes, const size_t chunk_size,
+			const unsigned long long length, const unsigned int depth,
+			const unsigned int held, const bool huge_pages);
+
+	/** Stops the background thread. */
+	~ChunkReader();
+
+	/** Retrieves the next chunk, waiting for it to be read.
+	 *
+	 *  @tparam Chunk chunk
+	 *      Set to the next chunk.
+	 *  @return
+	 *      `false` if there are no more chunks or reading failed.
+	 */
+	bool next(Chunk& chunk);
+
+	/** Notifies that the oldest retrieved chunk is no longer needed.
+	 *
+	 *  @tparam Chunk chunk
+	 *      Chunk as returned by `next`.
+	 */
+	void release(const Chunk& chunk);
+
+	/** Retrieves error code if reading stopped early.
+	 *
+	 *  @return
+	 *      0, `EIO` if the input ended before the selected range was read or
+	 *      `ENOMEM` if buffers could not be allocated.
+	 */
+	int error() const { return err; }
+
+	/** Retrieves number of bytes omitted at the end of a stream. */
+	size_t omitted() const { return omitted_bytes; }
+
+private:
+	InputFile& input;
+	const unsigned int wordbytes;
+	const size_t chunk_size;
+	const unsigned long long length;
+	const unsigned int depth;
+
+	// state of the reading thread
+	unsigned long long bytes_read;
+	char lookahead[8];
+	size_t lookahead_bytes;
+	bool finished;
+	int err;
+	size_t omitted_bytes;
+
+	BufferArena arena;
+	std::vector<char*> free_buffers;
+	std::deque<char*> used_buffers; // in order of chunks
+	std::deque<Chunk> ready; // chunks read ahead
+
+#if B2H_THREADS
+	std::thread thread;
+	std::mutex mutex;
+	std::condition_variable cond;
+	bool done;
+	bool stopping;
+
+	void work();
+#endif
+
+	char* takeBuffer();
+	bool readSized(char* buffer, Chunk& chunk);
+	bool readChunk(char* buffer, Chunk& chunk);
+};
+
+
+#endif /* B2H_READER_H_ */
@@ -0,0 +1,23 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// thread support
+
+#ifndef B2H_THREADS_H_
+#define B2H_THREADS_H_
+
+// std::thread is not available with the win32 thread model of MinGW
+#if !defined(__MINGW32__) || defined(_GLIBCXX_HAS_GTHREADS)
+#define B2H_THREADS 1
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#else
+#define B2H_THREADS 0
+#endif
+
+
+#endif /* B2H_THREADS_H_ */
@@ -52,4 +52,27 @@ extern long long currentTimeMillis();
 extern std::string formatDuration(const long long ts, const long long te);
 
 
+/** Formats a number of bytes for printing.
+ *
+ *  @param size
+ *      Number of bytes.
+ *  @return
+ *      String with size in largest fitting unit.
+ */
+extern std::string formatSize(const unsigned long long size);
+
+/** Retrieves peak physical memory used by the process.
+ *
+ *  @return
+ *      Number of bytes or 0 if not supported on this system.
+ */
+extern unsigned long long getPeakMemory();
+
+/** Resets peak physical memory to the memory currently used.
+ *
+ *  @return
+ *      `false` if not supported on this system (Linux only).
+ */
+extern bool resetPeakMemory();
+
 #endif /* B2H_UTIL_H_ */
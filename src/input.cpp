@@ -0,0 +1,226 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// large file support for mmap offsets on 32 bit systems
+#ifndef _FILE_OFFSET_BITS
+#define _FILE_OFFSET_BITS 64
+#endif
+
+#include "input.h"
+
+#include <algorithm> // min
+#include <iostream> // cin
+
+#ifdef __WIN32__
+#include <fcntl.h> // _O_BINARY
+#include <io.h> // _setmode
+#else
+#include <fcntl.h> // open
+#include <sys/mman.h> // mmap,madvise
+#include <sys/stat.h> // fstat
+#include <unistd.h> // close,sysconf
+#endif
+
+using namespace std;
+
+
+InputFile::InputFile() : file_size(0), sized(false), map(NULL), map_length(0),
+		map_pos(0), map_released(0), stream(&ifs) {}
+
+InputFile::~InputFile() {
+	close();
+}
+
+
+bool InputFile::open(const string path) {
+	close();
+
+	this->path = path;
+	if (path == "-") {
+#ifdef __WIN32__
+		_setmode(_fileno(stdin), _O_BINARY);
+#endif
+		stream = &cin;
+		sized = false;
+		return true;
+	}
+
+	stream = &ifs;
+	ifs.open(path.c_str(), ifstream::binary);
+	if (!ifs.is_open()) {
+		return false;
+	}
+
+	// pipes & other special files cannot seek
+	ifs.seekg(0, ifstream::end);
+	const streamoff end = ifs.tellg();
+	sized = end >= 0;
+	if (sized) {
+		file_size = end;
+		ifs.seekg(0, ifstream::beg);
+	} else {
+		ifs.clear();
+	}
+
+	return true;
+}
+
+
+void InputFile::close() {
+	unmap();
+	if (ifs.is_open()) {
+		ifs.close();
+	}
+	file_size = 0;
+	sized = false;
+	stream = &ifs;
+}
+
+
+bool InputFile::select(const unsigned long long offset, const unsigned long long length) {
+	unmap();
+	if (!sized) {
+		// skip leading bytes of a stream
+		unsigned long long skipped = 0;
+		while (skipped < offset && stream->good()) {
+			stream->ignore(min(offset - skipped, (unsigned long long) 1 << 30));
+			skipped += stream->gcount();
+		}
+
+		return skipped == offset;
+	}
+
+	if (length > 0 && mapRange(offset, length)) {
+		return true;
+	}
+
+	// fall back to streamed reads
+	ifs.clear();
+	ifs.seekg(offset);
+
+	return true;
+}
+
+
+const unsigned char* InputFile::read(char* buffer, const size_t size) {
+	if (map != NULL) {
+		if (size > map_length - map_pos) {
+			return NULL;
+		}
+
+		const unsigned char* chunk = map + map_pos;
+		map_pos += size;
+
+		return chunk;
+	}
+
+	if (readSome(buffer, size) != size) {
+		return NULL;
+	}
+
+	return (const unsigned char*) buffer;
+}
+
+
+size_t InputFile::readSome(char* buffer, const size_t size) {
+	stream->read(buffer, size);
+	return stream->gcount();
+}
+
+
+void InputFile::prefetch(const size_t size) {
+#ifndef __WIN32__
+	if (map == NULL || size == 0 || map_pos >= map_length) {
+		return;
+	}
+
+	// advice ranges must begin on a page boundary
+	static const size_t page_size = sysconf(_SC_PAGESIZE);
+	const size_t start = map_pos - map_pos % page_size;
+	const size_t end = min(map_pos + size, map_length);
+	madvise(map + start, end - start, MADV_WILLNEED);
+#endif
+}
+
+
+void InputFile::release(const unsigned char* end) {
+#ifndef __WIN32__
+	if (map == NULL || end < map || end > map + map_length) {
+		return;
+	}
+
+	// drop pages of consumed data to keep memory usage flat
+	static const size_t page_size = sysconf(_SC_PAGESIZE);
+	const size_t consumed = (end - map) - (end - map) % page_size;
+	if (consumed > map_released) {
+		madvise(map + map_released, consumed - map_released, MADV_DONTNEED);
+		map_released = consumed;
+	}
+#endif
+}
+
+
+/** Maps selected range of a regular file into memory.
+ *
+ *  @return
+ *      `false` if the file cannot be mapped.
+ */
+bool InputFile::mapRange(const unsigned long long offset, const unsigned long long length) {
+#ifdef __WIN32__
+	return false;
+#else
+	const int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)
+			|| offset + length > (unsigned long long) st.st_size) {
+		::close(fd);
+		return false;
+	}
+
+	// mappings must begin on a page boundary
+	const unsigned long long page_size = sysconf(_SC_PAGESIZE);
+	const unsigned long long aligned_offset = offset - offset % page_size;
+	const unsigned long long span = offset - aligned_offset + length;
+	if ((size_t) span != span) {
+		// window does not fit in address space
+		::close(fd);
+		return false;
+	}
+
+	void* addr = mmap(NULL, span, PROT_READ, MAP_PRIVATE, fd, aligned_offset);
+	// mapping remains valid after descriptor is closed
+	::close(fd);
+	if (addr == MAP_FAILED) {
+		return false;
+	}
+
+	madvise(addr, span, MADV_SEQUENTIAL);
+
+	map = (unsigned char*) addr;
+	map_length = span;
+	map_pos = offset - aligned_offset;
+	map_released = 0;
+
+	return true;
+#endif
+}
+
+
+void InputFile::unmap() {
+#ifndef __WIN32__
+	if (map != NULL) {
+		munmap(map, map_length);
+	}
+#endif
+	map = NULL;
+	map_length = 0;
+	map_pos = 0;
+	map_released = 0;
+}
@@ -0,0 +1,219 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+// large file support on 32 bit systems
+#ifndef _FILE_OFFSET_BITS
+#define _FILE_OFFSET_BITS 64
+#endif
+
+#include "output.h"
+
+#include <cerrno>
+
+#ifdef __WIN32__
+#include <fcntl.h> // _O_BINARY
+#include <io.h> // _setmode
+#else
+#include <fcntl.h> // open,fallocate
+#include <sys/stat.h> // fstat
+#include <sys/statvfs.h> // fstatvfs
+#include <unistd.h> // close,dup,ftruncate,pwrite,write
+#endif
+
+using namespace std;
+
+
+#ifdef __WIN32__
+
+OutputFile::OutputFile() : pos(0), positional(false), reserved(false), err(0), file(NULL) {}
+
+bool OutputFile::open(const string path) {
+	close();
+
+	this->path = path;
+	if (path == "-") {
+		_setmode(_fileno(stdout), _O_BINARY);
+		file = stdout;
+		return true;
+	}
+
+	// don't truncate existing file yet
+	file = fopen(path.c_str(), "r+b");
+	if (file == NULL) {
+		file = fopen(path.c_str(), "wb");
+	}
+
+	return file != NULL;
+}
+
+void OutputFile::close() {
+	if (file != NULL) {
+		if (file != stdout) fclose(file);
+		else fflush(file);
+		file = NULL;
+	}
+	pos = 0;
+	reserved = false;
+}
+
+int OutputFile::reserve(const unsigned long long size) {
+	if (file == stdout) {
+		reserved = true;
+		return 0;
+	}
+
+	// discard previous contents
+	file = freopen(path.c_str(), "wb", file);
+	if (file == NULL) {
+		fail(errno);
+		return errno;
+	}
+
+	reserved = true;
+	return 0;
+}
+
+bool OutputFile::write(const char* data, const size_t size) {
+	if (fwrite(data, 1, size, file) != size) {
+		fail(EIO);
+		return false;
+	}
+
+	pos += size;
+	return true;
+}
+
+bool OutputFile::writeAt(const unsigned long long pos, const char* data, const size_t size) {
+	fail(ENOTSUP);
+	return false;
+}
+
+void OutputFile::truncate() {}
+
+#else
+
+OutputFile::OutputFile() : pos(0), positional(false), reserved(false), err(0), fd(-1) {}
+
+bool OutputFile::open(const string path) {
+	close();
+
+	if (path == "-") {
+		// always append, stdout may be shared with other writers
+		fd = dup(STDOUT_FILENO);
+		return fd >= 0;
+	}
+
+	// don't truncate existing file yet
+	fd = ::open(path.c_str(), O_WRONLY | O_CREAT, 0666);
+	if (fd < 0) {
+		return false;
+	}
+
+	struct stat st;
+	positional = fstat(fd, &st) == 0 && S_ISREG(st.st_mode);
+
+	return true;
+}
+
+void OutputFile::close() {
+	if (fd >= 0) {
+		// drop anything allocated past the written data
+		if (reserved) truncate();
+		::close(fd);
+		fd = -1;
+	}
+	pos = 0;
+	positional = false;
+	reserved = false;
+}
+
+int OutputFile::reserve(const unsigned long long size) {
+	if (positional) {
+		// space used by the previous contents is freed when truncating
+		struct stat st;
+		struct statvfs vfs;
+		if (fstat(fd, &st) == 0 && fstatvfs(fd, &vfs) == 0) {
+			const unsigned long long available = (unsigned long long) vfs.f_bavail * vfs.f_frsize
+					+ (unsigned long long) st.st_blocks * 512;
+			if (size > available) {
+				return ENOSPC;
+			}
+		}
+
+		if (ftruncate(fd, 0) != 0) {
+			fail(errno);
+			return errno;
+		}
+
+#ifdef __linux__
+		// filesystems without native support are left to allocate while writing
+		if (size > 0 && fallocate(fd, 0, 0, size) != 0 && (errno == ENOSPC || errno == EFBIG)) {
+			return errno;
+		}
+#endif
+	}
+
+	pos = 0;
+	reserved = true;
+	return 0;
+}
+
+bool OutputFile::write(const char* data, const size_t size) {
+	if (positional) {
+		if (!writeAt(pos, data, size)) {
+			return false;
+		}
+		pos += size;
+		return true;
+	}
+
+	size_t done = 0;
+	while (done < size) {
+		const ssize_t res = ::write(fd, data + done, size - done);
+		if (res < 0) {
+			if (errno == EINTR) continue;
+			fail(errno);
+			return false;
+		}
+		done += res;
+	}
+
+	pos += size;
+	return true;
+}
+
+bool OutputFile::writeAt(const unsigned long long pos, const char* data, const size_t size) {
+	size_t done = 0;
+	while (done < size) {
+		const ssize_t res = pwrite(fd, data + done, size - done, pos + done);
+		if (res < 0) {
+			if (errno == EINTR) continue;
+			fail(errno);
+			return false;
+		}
+		done += res;
+	}
+
+	return true;
+}
+
+void OutputFile::truncate() {
+	if (positional && ftruncate(fd, pos) != 0) {
+		fail(errno);
+	}
+}
+
+#endif
+
+OutputFile::~OutputFile() {
+	close();
+}
+
+/** Records error code if no previous error occurred. */
+void OutputFile::fail(const int code) {
+	int none = 0;
+	err.compare_exchange_strong(none, code);
+}
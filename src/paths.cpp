@@ -6,10 +6,16 @@
  */
 
 #include "paths.h"
+#include "threads.h"
 #include "util.h"
 
-#include <algorithm> // transform
+#include <algorithm> // min,transform
+#include <climits> // PATH_MAX
+#include <cstdlib> // realpath,_fullpath
+#include <dirent.h> // opendir,readdir
 #include <sstream>
+#include <sys/stat.h> // lstat,stat
+#include <vector>
 
 using namespace std;
 
@@ -116,3 +122,178 @@ string getDirName(string path) {
 
 	return path;
 }
+
+
+string getAbsolutePath(const string path) {
+#ifdef __WIN32__
+	char resolved[_MAX_PATH];
+	if (_fullpath(resolved, path.c_str(), _MAX_PATH) == NULL) {
+		return "";
+	}
+#else
+	char resolved[PATH_MAX];
+	if (realpath(path.c_str(), resolved) == NULL) {
+		return "";
+	}
+#endif
+
+	return resolved;
+}
+
+
+/** Splits a path into its nodes.
+ *
+ *  @tparam string path
+ *      Absolute path with native delimeters.
+ *  @return
+ *      List of non-empty nodes.
+ */
+static vector<string> splitPath(const string path) {
+#ifdef __WIN32__
+	const char sep = '\\';
+#else
+	const char sep = '/';
+#endif
+
+	vector<string> nodes;
+	stringstream ss(path);
+	string node;
+	while (getline(ss, node, sep)) {
+		if (!node.empty()) nodes.push_back(node);
+	}
+
+	return nodes;
+}
+
+
+string getRelativePath(const string path, const string dir) {
+	const string abs_path = getAbsolutePath(path);
+	const string abs_dir = getAbsolutePath(dir);
+	if (checkEmptyString(abs_path) || checkEmptyString(abs_dir)) {
+		return "";
+	}
+
+	const vector<string> path_nodes = splitPath(abs_path);
+	const vector<string> dir_nodes = splitPath(abs_dir);
+
+	size_t common = 0;
+	while (common < path_nodes.size() && common < dir_nodes.size()
+			&& path_nodes[common] == dir_nodes[common]) {
+		common++;
+	}
+
+#ifdef __WIN32__
+	// no relative path between drives
+	if (common == 0) {
+		return abs_path;
+	}
+#endif
+
+	vector<string> nodes(dir_nodes.size() - common, "..");
+	nodes.insert(nodes.end(), path_nodes.begin() + common, path_nodes.end());
+	if (nodes.empty()) {
+		return ".";
+	}
+
+	string relative = nodes[0];
+	for (size_t idx = 1; idx < nodes.size(); idx++) {
+		relative = joinPath(relative, nodes[idx]);
+	}
+
+	return relative;
+}
+
+
+vector<string> listDirectory(const string path) {
+	vector<string> names;
+	DIR* dir = opendir(path.c_str());
+	if (dir == NULL) {
+		return names;
+	}
+
+	for (struct dirent* ent = readdir(dir); ent != NULL; ent = readdir(dir)) {
+		const string name = ent->d_name;
+		if (name != "." && name != "..") {
+			names.push_back(name);
+		}
+	}
+	closedir(dir);
+
+	return names;
+}
+
+
+vector<TreeFile> findFiles(const string dir, const unsigned int jobs) {
+	vector<TreeFile> files;
+
+	// directories of the current level, relative to the root ("" is the root)
+	vector<string> level(1, "");
+	while (!level.empty()) {
+		vector<string> next_level;
+		size_t next_dir = 0;
+#if B2H_THREADS
+		std::mutex mutex;
+#endif
+
+		const auto work = [&]() {
+			for (;;) {
+				string rel_dir;
+				{
+#if B2H_THREADS
+					lock_guard<std::mutex> lock(mutex);
+#endif
+					if (next_dir >= level.size()) {
+						return;
+					}
+					rel_dir = level[next_dir++];
+				}
+
+				vector<string> subdirs;
+				vector<TreeFile> found;
+				const vector<string> names = listDirectory(rel_dir.empty() ? dir : joinPath(dir, rel_dir));
+				for (size_t idx = 0; idx < names.size(); idx++) {
+					const string rel_path = rel_dir.empty() ? names[idx] : rel_dir + "/" + names[idx];
+					const string path = joinPath(dir, rel_path);
+
+					struct stat st;
+#ifdef __WIN32__
+					if (stat(path.c_str(), &st) != 0) continue;
+#else
+					if (lstat(path.c_str(), &st) != 0) continue;
+					if (S_ISLNK(st.st_mode) && (stat(path.c_str(), &st) != 0 || !S_ISREG(st.st_mode))) continue;
+#endif
+					if (S_ISDIR(st.st_mode)) {
+						subdirs.push_back(rel_path);
+					} else if (S_ISREG(st.st_mode)) {
+						const TreeFile file = {rel_path, (unsigned long long) st.st_size};
+						found.push_back(file);
+					}
+				}
+
+#if B2H_THREADS
+				lock_guard<std::mutex> lock(mutex);
+#endif
+				next_level.insert(next_level.end(), subdirs.begin(), subdirs.end());
+				files.insert(files.end(), found.begin(), found.end());
+			}
+		};
+
+		const unsigned int workers = (unsigned int) min((size_t) max(jobs, 1U), level.size());
+#if B2H_THREADS
+		vector<thread> threads;
+		for (unsigned int idx = 1; idx < workers; idx++) {
+			threads.push_back(thread(work));
+		}
+		work();
+		for (size_t idx = 0; idx < threads.size(); idx++) {
+			threads[idx].join();
+		}
+#else
+		work();
+#endif
+
+		level.swap(next_level);
+	}
+
+	return files;
+}
@@ -0,0 +1,164 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+#include "pipeline.h"
+
+using namespace std;
+
+
+unsigned int getHardwareThreads() {
+	unsigned int count = 0;
+#if B2H_THREADS
+	count = thread::hardware_concurrency();
+#endif
+	return count > 0 ? count : 1;
+}
+
+
+ChunkPipeline::ChunkPipeline(OutputFile& out, ChunkReader& reader, const LineFormat& fmt,
+		const unsigned int jobs)
+		: out(out), reader(reader), fmt(fmt), positional(false),
+		next_offset(out.tell()), submitted(0), formatting(0), written(0) {
+#if B2H_THREADS
+	stopping = false;
+	if (jobs > 1) {
+		positional = out.isPositional() && fmt.fixedSize();
+		slots.resize(capacity(jobs));
+		for (unsigned int idx = 0; idx < jobs; idx++) {
+			workers.push_back(thread(&ChunkPipeline::work, this));
+		}
+		return;
+	}
+#endif
+
+	slots.resize(capacity(1));
+}
+
+ChunkPipeline::~ChunkPipeline() {
+#if B2H_THREADS
+	{
+		lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	work_cond.notify_all();
+
+	for (unsigned int idx = 0; idx < workers.size(); idx++) {
+		workers[idx].join();
+	}
+#endif
+}
+
+
+unsigned int ChunkPipeline::capacity(const unsigned int jobs) {
+#if B2H_THREADS
+	if (jobs > 1) {
+		// let readers stay ahead of workers so they never run out of chunks
+		return jobs * 2;
+	}
+#endif
+	return 1;
+}
+
+
+void ChunkPipeline::submit(const ChunkReader::Chunk& chunk) {
+	while (submitted - written >= slots.size()) {
+		writeNext();
+	}
+
+	Slot& slot = slots[submitted % slots.size()];
+	slot.chunk = chunk;
+	slot.ready = false;
+	slot.offset = next_offset;
+	next_offset += formattedSize(chunk.size, fmt, chunk.last);
+
+#if B2H_THREADS
+	if (!workers.empty()) {
+		{
+			lock_guard<std::mutex> lock(mutex);
+			submitted++;
+		}
+		work_cond.notify_one();
+
+		// write anything already formatted without waiting
+		for (;;) {
+			{
+				lock_guard<std::mutex> lock(mutex);
+				if (written == submitted || !slots[written % slots.size()].ready) {
+					break;
+				}
+			}
+			writeNext();
+		}
+
+		return;
+	}
+#endif
+
+	slot.text.clear();
+	formatLines(slot.text, chunk.data, chunk.size, fmt, chunk.last);
+	slot.ready = true;
+	submitted++;
+
+	writeNext();
+}
+
+
+void ChunkPipeline::finish() {
+	while (written < submitted) {
+		writeNext();
+	}
+}
+
+
+/** Writes the oldest queued chunk, waiting for it to be formatted. */
+void ChunkPipeline::writeNext() {
+	Slot& slot = slots[written % slots.size()];
+
+#if B2H_THREADS
+	{
+		unique_lock<std::mutex> lock(mutex);
+		done_cond.wait(lock, [&slot] { return slot.ready; });
+	}
+#endif
+
+	if (positional) {
+		out.skip(slot.text.size());
+	} else {
+		out.write(slot.text);
+	}
+	reader.release(slot.chunk);
+
+	slot.ready = false;
+	written++;
+}
+
+
+#if B2H_THREADS
+/** Worker thread loop formatting queued chunks. */
+void ChunkPipeline::work() {
+	unique_lock<std::mutex> lock(mutex);
+	for (;;) {
+		work_cond.wait(lock, [this] { return stopping || formatting < submitted; });
+		if (formatting == submitted) {
+			return;
+		}
+
+		Slot& slot = slots[formatting % slots.size()];
+		formatting++;
+
+		lock.unlock();
+		slot.text.clear();
+		formatLines(slot.text, slot.chunk.data, slot.chunk.size, fmt, slot.chunk.last);
+		if (positional) {
+			out.writeAt(slot.offset, slot.text.data(), slot.text.size());
+		}
+		lock.lock();
+
+		slot.ready = true;
+		done_cond.notify_one();
+	}
+}
+#endif
@@ -0,0 +1,252 @@
+/* Copyright © 2017-2022 Jordan Irwin (AntumDeluge) <antumdeluge@gmail.com>
+ *
+ * This file is part of the bin2header project & is distributed under the
+ * terms of the MIT/X11 license. See: LICENSE.txt
+ */
+
+#include "reader.h"
+
+#include <cerrno>
+#include <cstdint> // SIZE_MAX
+#include <cstring> // memcpy
+
+using namespace std;
+
+
+ChunkReader::ChunkReader(InputFile& input, const unsigned int wordbytes, const size_t chunk_size,
+		const unsigned long long length, const unsigned int depth,
+		const unsigned int held, const bool huge_pages)
+		: input(input), wordbytes(wordbytes), chunk_size(chunk_size), length(length),
+		depth(depth), bytes_read(0), lookahead_bytes(0), finished(false), err(0),
+		omitted_bytes(0) {
+	if (!input.isMapped()) {
+		// chunks held by consumer, queued, one being read & one being handed over
+		const size_t count = (size_t) held + depth + 2;
+		if (count > SIZE_MAX / chunk_size || !arena.allocate(count * chunk_size, huge_pages)) {
+			err = ENOMEM;
+			finished = true;
+		}
+	}
+
+#if B2H_THREADS
+	done = false;
+	stopping = false;
+	if (depth > 0 && !input.isMapped() && !finished) {
+		thread = std::thread(&ChunkReader::work, this);
+	}
+#endif
+}
+
+ChunkReader::~ChunkReader() {
+#if B2H_THREADS
+	if (thread.joinable()) {
+		{
+			lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		cond.notify_all();
+		thread.join();
+	}
+#endif
+}
+
+
+bool ChunkReader::next(Chunk& chunk) {
+	if (input.isMapped()) {
+		if (!readSized(NULL, chunk)) {
+			return false;
+		}
+
+		// start paging in the following chunks while this one is formatted
+		input.prefetch(depth * chunk_size);
+		return true;
+	}
+
+#if B2H_THREADS
+	if (thread.joinable()) {
+		unique_lock<std::mutex> lock(mutex);
+		cond.wait(lock, [this] { return !ready.empty() || done; });
+		if (ready.empty()) {
+			return false;
+		}
+
+		chunk = ready.front();
+		ready.pop_front();
+		cond.notify_all();
+		return true;
+	}
+#endif
+
+	char* buffer = takeBuffer();
+	if (buffer == NULL || !readChunk(buffer, chunk)) {
+		if (buffer != NULL) free_buffers.push_back(buffer);
+		return false;
+	}
+
+	used_buffers.push_back(buffer);
+	return true;
+}
+
+
+void ChunkReader::release(const Chunk& chunk) {
+	if (input.isMapped()) {
+		input.release(chunk.data + chunk.size);
+		return;
+	}
+
+#if B2H_THREADS
+	lock_guard<std::mutex> lock(mutex);
+#endif
+	// chunks are released in the order they were read
+	if (!used_buffers.empty()) {
+		free_buffers.push_back(used_buffers.front());
+		used_buffers.pop_front();
+	}
+#if B2H_THREADS
+	cond.notify_all();
+#endif
+}
+
+
+#if B2H_THREADS
+/** Background thread loop reading chunks ahead of the consumer. */
+void ChunkReader::work() {
+	unique_lock<std::mutex> lock(mutex);
+	for (;;) {
+		cond.wait(lock, [this] { return stopping || ready.size() < depth; });
+		if (stopping) {
+			return;
+		}
+
+		char* buffer = takeBuffer();
+		lock.unlock();
+		Chunk chunk;
+		const bool more = buffer != NULL && readChunk(buffer, chunk);
+		lock.lock();
+
+		if (more) {
+			used_buffers.push_back(buffer);
+			ready.push_back(chunk);
+		} else if (buffer != NULL) {
+			free_buffers.push_back(buffer);
+		}
+
+		if (!more || chunk.last) {
+			done = true;
+			cond.notify_all();
+			return;
+		}
+		cond.notify_all();
+	}
+}
+#endif
+
+
+/** Retrieves an unused chunk buffer, taking a new one from the arena if needed.
+ *
+ *  @return
+ *      Buffer or `NULL` if none is available.
+ */
+char* ChunkReader::takeBuffer() {
+	if (free_buffers.empty()) {
+		char* buffer = arena.take(chunk_size);
+		if (buffer == NULL) {
+			err = ENOMEM;
+		}
+		return buffer;
+	}
+
+	char* buffer = free_buffers.back();
+	free_buffers.pop_back();
+	return buffer;
+}
+
+
+/** Reads the next chunk of input with a known size.
+ *
+ *  @tparam char* buffer
+ *      Buffer of `chunk_size` bytes (not used for memory mapped input).
+ *  @tparam Chunk chunk
+ *      Set to chunk read.
+ *  @return
+ *      `false` at the end of the range or if reading failed.
+ */
+bool ChunkReader::readSized(char* buffer, Chunk& chunk) {
+	if (finished) {
+		return false;
+	}
+
+	if (bytes_read >= length) {
+		finished = true;
+		return false;
+	}
+
+	size_t size = chunk_size;
+	if (length - bytes_read < size) {
+		size = length - bytes_read;
+	}
+
+	chunk.data = input.read(buffer, size);
+	if (chunk.data == NULL) {
+		err = EIO;
+		finished = true;
+		return false;
+	}
+
+	bytes_read += size;
+	chunk.size = size;
+	chunk.last = bytes_read >= length;
+	finished = chunk.last;
+	return true;
+}
+
+/** Reads the next chunk of the selected range.
+ *
+ *  @tparam char* buffer
+ *      Buffer of `chunk_size` bytes.
+ *  @tparam Chunk chunk
+ *      Set to chunk read.
+ *  @return
+ *      `false` at the end of the range or if reading failed.
+ */
+bool ChunkReader::readChunk(char* buffer, Chunk& chunk) {
+	if (input.hasSize()) {
+		return readSized(buffer, chunk);
+	} else if (finished) {
+		return false;
+	}
+
+	// streams are read until they end, looking ahead by one word so that
+	// the chunk holding the final line is known when it is read
+	const size_t carried = lookahead_bytes;
+	size_t size = chunk_size;
+	if (length > 0 && length - bytes_read < size - carried) {
+		size = carried + (length - bytes_read);
+	}
+
+	memcpy(buffer, lookahead, carried);
+	const size_t received = input.readSome(buffer + carried, size - carried);
+	bytes_read += received;
+	size = carried + received;
+
+	// only a full chunk can be followed by more data
+	lookahead_bytes = 0;
+	if (size == chunk_size) {
+		size_t peek = wordbytes;
+		if (length > 0 && length - bytes_read < peek) peek = length - bytes_read;
+		lookahead_bytes = input.readSome(lookahead, peek);
+		bytes_read += lookahead_bytes;
+	}
+
+	chunk.last = lookahead_bytes < wordbytes;
+	if (chunk.last) {
+		// FIXME: incomplete words not processed
+		omitted_bytes = size % wordbytes + lookahead_bytes;
+		size -= size % wordbytes;
+		finished = true;
+	}
+
+	chunk.data = (const unsigned char*) buffer;
+	chunk.size = size;
+	return size > 0;
+}
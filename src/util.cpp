@@ -9,8 +9,18 @@
 
 #include <chrono>
 #include <cmath>
+#include <cstdlib> // strtoull
+#include <iomanip> // setprecision
 #include <sstream>
 
+#ifndef __WIN32__
+#include <sys/resource.h> // getrusage
+#endif
+
+#ifdef __linux__
+#include <fstream>
+#endif
+
 using namespace std;
 
 
@@ -79,3 +89,66 @@ string formatDuration(const long long ts, const long long te) {
 
 	return dmsg.str();
 }
+
+
+string formatSize(const unsigned long long size) {
+	static const char* units[] = {"bytes", "KB", "MB", "GB", "TB"};
+
+	double value = size;
+	unsigned int unit = 0;
+	while (value >= 1024 && unit < 4) {
+		value /= 1024;
+		unit++;
+	}
+
+	stringstream smsg;
+	if (unit == 0) {
+		smsg << size << " " << units[unit];
+	} else {
+		smsg << fixed << setprecision(1) << value << " " << units[unit];
+	}
+
+	return smsg.str();
+}
+
+
+unsigned long long getPeakMemory() {
+#ifdef __WIN32__
+	return 0;
+#else
+#ifdef __linux__
+	// unlike the resource usage, this is reset by `resetPeakMemory`
+	ifstream status("/proc/self/status");
+	string line;
+	while (getline(status, line)) {
+		if (line.compare(0, 6, "VmHWM:") == 0) {
+			return strtoull(line.c_str() + 6, NULL, 10) * 1024;
+		}
+	}
+#endif
+
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) {
+		return 0;
+	}
+
+#ifdef __APPLE__
+	return usage.ru_maxrss;
+#else
+	// reported in kilobytes
+	return (unsigned long long) usage.ru_maxrss * 1024;
+#endif
+#endif
+}
+
+
+bool resetPeakMemory() {
+#ifdef __linux__
+	ofstream clear_refs("/proc/self/clear_refs");
+	clear_refs << "5";
+	clear_refs.close();
+	return !clear_refs.fail();
+#else
+	return false;
+#endif
+}
@@ -59,14 +59,151 @@ compare "32"
 execute -p 32 -e -o "${dir_out}/flower.32be.h" "flower.png"
 compare "32be"
 
+execute -p 64 -o "${dir_out}/flower.64.h" "flower.png"
+compare "64"
+
+execute -p 64 -e -o "${dir_out}/flower.64be.h" "flower.png"
+compare "64be"
+
 execute -n rock -o "${dir_out}/flower.rock.h" "flower.png"
 compare "rock"
 
 execute -c -o "${dir_out}/flower.comment.h" "flower.png"
 compare "comment"
 
+# "*/" in the data must not end content comments
+printf 'a*/b**/c*/*/' > "${dir_out}/stars.bin"
+execute -c -d 4 -o "${dir_out}/stars.bin.h" "${dir_out}/stars.bin"
+diff -q "orig/stars.bin.h" "${dir_out}/stars.bin.h"
+check_result $?
+
 execute -d 4 -o "${dir_out}/flower.nbdata.h" "flower.png"
 compare "nbdata"
 
+# options only supported by native executable
+if ! ./bin2header -v | grep "(Python)" > /dev/null; then
+	execute -j 4 -s 36 -c -o "${dir_out}/flower.jobs.h" "flower.png"
+	diff -q "orig/flower.comment.h" "${dir_out}/flower.jobs.h"
+	check_result $?
+
+	echo -e "\nExecuting with params: -n flower_png -s 36 - < flower.png"
+	./bin2header -n flower_png -s 36 - < "flower.png" > "${dir_out}/flower.stream.h"
+	check_result $?
+	diff -q "orig/flower.default.h" "${dir_out}/flower.stream.h"
+	check_result $?
+
+	execute --format string -o "${dir_out}/flower.string.h" "flower.png"
+	compare "string"
+
+	execute --format embed -o "${dir_out}/flower.embed.h" "flower.png"
+	compare "embed"
+
+	# assembler source refers to input by absolute path
+	execute --format incbin -o "${dir_out}/flower.incbin.h" "flower.png"
+	compare "incbin"
+	grep -q "\.incbin \".*/flower\.png\", 0, 1969" "${dir_out}/flower.incbin.S"
+	check_result $?
+
+	execute --format elf64 -o "${dir_out}/flower.elf.h" "flower.png"
+	compare "elf"
+	readelf -h "${dir_out}/flower.elf.o" | grep -q "REL (Relocatable file)"
+	check_result $?
+	readelf -S "${dir_out}/flower.elf.o" | grep -q " \.rodata "
+	check_result $?
+	readelf -S "${dir_out}/flower.elf.o" | grep -q " \.note\.GNU-stack "
+	check_result $?
+
+	execute --format elf32 --section .b2h_data -o "${dir_out}/flower.elf32.h" "flower.png"
+	readelf -S "${dir_out}/flower.elf32.o" | grep -q " \.b2h_data "
+	check_result $?
+	readelf -S "${dir_out}/flower.elf32.o" | grep -q " \.note\.GNU-stack "
+	check_result $?
+
+	execute --split -o "${dir_out}/flower.split.h" "flower.png"
+	compare "split"
+	diff -q "orig/flower.split.c" "${dir_out}/flower.split.c"
+	check_result $?
+
+	execute --view span -o "${dir_out}/flower.span.h" "flower.png"
+	compare "span"
+
+	execute --shard-size 1024 -o "${dir_out}/flower.shard.h" "flower.png"
+	compare "shard"
+	for src in "flower.shard.c" "flower.shard.1.c"; do
+		diff -q "orig/${src}" "${dir_out}/${src}"
+		check_result $?
+	done
+	test -f "${dir_out}/flower.shard.0.c" && ! test -f "${dir_out}/flower.shard.2.c"
+	check_result $?
+
+	execute --align 64 --section ".assets" -o "${dir_out}/flower.align.h" "flower.png"
+	compare "align"
+
+	# several files converted at once are written to the output directory
+	mkdir -p "${dir_out}/batch"
+	cp "flower.png" "${dir_out}/flower2.png"
+	printf "flower.png\n" > "${dir_out}/batch.list"
+	execute -j 2 -o "${dir_out}/batch" "@${dir_out}/batch.list" "${dir_out}/flower2.png"
+	diff -q "orig/flower.default.h" "${dir_out}/batch/flower.png.h"
+	check_result $?
+	test -f "${dir_out}/batch/flower2.png.h"
+	check_result $?
+
+	# unchanged output keeps its modification time, output with other options is rewritten
+	execute --skip-unchanged -o "${dir_out}/flower.skip.h" "flower.png"
+	tail -n +2 "${dir_out}/flower.skip.h" | diff -q "orig/flower.default.h" -
+	check_result $?
+	touch -d "2000-01-01" "${dir_out}/flower.skip.h"
+	execute --skip-unchanged -o "${dir_out}/flower.skip.h" "flower.png"
+	test "${dir_out}/flower.skip.h" -ot "${dir_out}/flower2.png"
+	check_result $?
+	execute --skip-unchanged -d 8 -o "${dir_out}/flower.skip.h" "flower.png"
+	test "${dir_out}/flower.skip.h" -nt "${dir_out}/flower2.png"
+	check_result $?
+
+	# output of an interrupted conversion is not left as unchanged
+	head -c 1048576 /dev/zero > "${dir_out}/zero.bin"
+	mkfifo "${dir_out}/progress"
+	for params in "" "--split"; do
+		echo -e "\nInterrupting with params: ${params}"
+		./bin2header --skip-unchanged ${params} -s 16 -o "${dir_out}/zero.h" "${dir_out}/zero.bin" > "${dir_out}/progress" &
+		pid=$!
+		# progress messages fill the unread pipe & block the conversion before it ends
+		exec 3< "${dir_out}/progress"
+		head -c 1 <&3 > /dev/null
+		kill -INT ${pid}
+		cat <&3 > /dev/null
+		exec 3<&-
+		wait ${pid}
+		test $? -ne 0
+		check_result $?
+
+		./bin2header --skip-unchanged ${params} -o "${dir_out}/zero.h" "${dir_out}/zero.bin" | grep -q "Unchanged"
+		test $? -ne 0
+		check_result $?
+		./bin2header --skip-unchanged ${params} -o "${dir_out}/zero.h" "${dir_out}/zero.bin" | grep -q "Unchanged"
+		check_result $?
+	done
+
+	# second conversion is copied from the cache
+	execute --cache-dir "${dir_out}/cache" -o "${dir_out}/flower.cache.h" "flower.png"
+	execute --cache-dir "${dir_out}/cache" -o "${dir_out}/flower.cached.h" "flower.png" | grep -q "From cache"
+	check_result $?
+	diff -q "orig/flower.default.h" "${dir_out}/flower.cached.h"
+	check_result $?
+
+	# files below a directory stored in one array with an index sorted by path
+	mkdir -p "${dir_out}/flower/images"
+	cp "flower.png" "${dir_out}/flower/images/flower.png"
+	cp "flower.png" "${dir_out}/flower/flower.png"
+	touch "${dir_out}/flower/empty"
+	execute --bundle "${dir_out}/flower" -j 2 -o "${dir_out}/flower.bundle.h"
+	compare "bundle"
+
+	# data of several files found by name with a perfect hash
+	execute -o "${dir_out}/batch" --index "${dir_out}/flower.index.h" "flower.png" "${dir_out}/flower2.png"
+	compare "index"
+fi
+
 execute --stdvector -o "${dir_out}/flower.vector.h" "flower.png"
 compare "vector"
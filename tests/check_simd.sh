@@ -0,0 +1,39 @@
+#!/usr/bin/env bash
+
+# Compares output of the vector encoding kernels against the scalar encoder
+# using random input data.
+
+cd "$(dirname $0)"
+
+dir_out="out/simd"
+rm -rf "${dir_out}"
+mkdir -p "${dir_out}"
+
+check_result() {
+	if test $1 -gt 0; then
+		exit 1
+	fi
+}
+
+for size in 1 15 16 17 31 32 33 100 1021 65536; do
+	head -c ${size} /dev/urandom > "${dir_out}/random.bin"
+
+	for params in "-p 8" "-p 8 -c" "-p 16" "-p 16 -e -c" "-p 32" "-p 32 -e" "-p 32 -d 16" "-p 64" "-p 64 -e -c" "-p 64 -d 5" "-d 1" "-d 33 --eol crlf"; do
+		BIN2HEADER_SIMD=scalar ./bin2header ${params} -o "${dir_out}/scalar.h" "${dir_out}/random.bin" > /dev/null
+		check_result $?
+
+		for simd in sse2 ssse3 avx2; do
+			BIN2HEADER_SIMD=${simd} ./bin2header ${params} -o "${dir_out}/${simd}.h" "${dir_out}/random.bin" > /dev/null
+			check_result $?
+
+			diff -q "${dir_out}/scalar.h" "${dir_out}/${simd}.h"
+			res=$?
+			if test ${res} -ne 0; then
+				echo "ERROR: ${simd} output differs (size: ${size}, params: ${params})"
+				exit ${res}
+			fi
+		done
+	done
+done
+
+echo "Vector encoder output matches scalar encoder"
@@ -0,0 +1,19 @@
+#!/usr/bin/bash
+
+
+cd "$(dirname $0)"
+
+
+echo -e "\nChecking object data to image copy export ..."
+mkdir -p out
+./bin2header --format elf64 -o out/flower.png.h flower.png > /dev/null || exit 1
+for sym in "flower_png" "flower_png_end" "flower_png_size"; do
+	nm out/flower.png.o | grep -q " R ${sym}$" || exit 1
+done
+readelf -S out/flower.png.o | grep -q " \.rodata " || exit 1
+readelf -S out/flower.png.o | grep -q " \.note\.GNU-stack " || exit 1
+# a missing stack note makes the linker warn about an executable stack
+g++ -Iout export_flower.cpp out/flower.png.o -Wl,--fatal-warnings -o out/export_flower || exit 1
+(cd out && ./export_flower)
+diff -q flower.png out/flower_copy.png
+exit $?
@@ -0,0 +1,28 @@
+#ifndef FLOWER_PNG_H
+#define FLOWER_PNG_H
+
+static const unsigned long long flower_png[] = {
+	0x89504e470d0a1a0a, 0x0000000d49484452, 0x0000004000000040, 0x08030000009db781, 0xec000002fd504c54, 0x453a000025000329, 0x00003c0100410003, 0x4400004500004501, 0x014b00004c00004d, 0x00004e0001540000, 0x5600005002005700, 0x015e00006000015a,
+	0x0200610002620000, 0x6900006a00016b00, 0x026c00006503006d, 0x0100730000740001, 0x7500027600007700, 0x006e03007d000079, 0x02008200007a0400, 0x8800018900028302, 0x008b00008403008d, 0x01009300009e0000, 0xa00001a10002a301, 0x00ae0002af0200b7,
+	0x0000b80000b90000, 0xbf0000c20000c300, 0x00c50000bb0401cd, 0x0000cd0003d00000, 0xd10006c70400d201, 0x00d80000d90001db, 0x0002dc0000dc0003, 0xdb000dde0100d203, 0x10e20000e80000e9, 0x0001e7000be9000d, 0xef0000f00000f200, 0x00f30000f10007f4,
+	0x0000ea0300fb0002, 0xf60200fd0000fc00, 0x03ff0000ff0000eb, 0x0804ff0114f70600, 0xe10c07d7110bcd14, 0x16a22121d7121cc4, 0x1819ce161ed81415, 0xcf1818d91616d11a, 0x19d21c1aca211dca, 0x2124ba2628cb2325, 0xc42621cd241fcd24, 0x25c52829bf2b2cff,
+	0x1b14cf272dff1d1d, 0xd22a29cb2e2dc230, 0x34cb2f33b73636cd, 0x3134c73432ba3a39, 0xc83638ca3734c239, 0x3cbd3c3bc53b38c4, 0x3b3dcc393bbf3e3c, 0xfe2d2dc63d3fff2f, 0x2eff3135cb4243c5, 0x4441cd423ec54446, 0xbf4644ce4445c746, 0x48c34a48cb4845cb,
+	0x4a4bff3c3db25154, 0xce4c4dc2504fc94f, 0x4ccb5154c65352ff, 0x4645c15758ff4745, 0xc85654ff484cb75c, 0x5cc4595acb5856c5, 0x5a5acd5a58cc5a5d, 0xc35f5cff4f4dca5f, 0x5fff5154cc6060c8, 0x6360ce6262c46766, 0xff5856ff5957ff5a, 0x5dcc686ac86a69c9,
+	0x6c6bff605eff6260, 0xff6266ca7475fe68, 0x67ff6a68ff6b69cf, 0x7879ca7a79ff6c70, 0xfe6f70d27b7ccd7d, 0x7bff7272d57e7fff, 0x7373d28280ff7774, 0xd48381ce8587ff78, 0x7adb8384ff7a7cfd, 0x7e7cd28a8bff807e, 0xdb8a88ff8180dd8b, 0x89d68d8eff8286df,
+	0x8d8bd88f90e08e8c, 0xdf8e92fe8687ff87, 0x88e3908edd9394e2, 0x9295e69391ff8d8b, 0xff8e8cff9093e398, 0x99de9a99e59a9bfe, 0x9494e29f9dff9797, 0xe99e9ffe9b98eca1, 0xa1ff9d9aeda2a2ff, 0x9ea1efa4a4f0a5a5, 0xfda2a2fea3a3f3a7, 0xa8ffa4a4ffa5a5f4,
+	0xa8a9f5a9aafda9a6, 0xf7abacffaaa7f8ac, 0xadffacaffaaeafff, 0xadb0ffaeb1fdb0b1, 0xfeb2b2ffb3b3281e, 0x45f6000000017452, 0x4e530040e6d86600, 0x0000097048597300, 0x000dd700000dd701, 0x42289b7800000007, 0x74494d4507e3090c, 0x022d200302b00c00,
+	0x00043a4944415458, 0xc3ed576d6c535518, 0x9e62b6a4668c743f, 0x6e96c6a46edd8f6e, 0x66b0b0a44b980959, 0x43b4c1255d737f3c, 0x81ccaf7d64cc6a10, 0x27207e200a16fc66, 0x53941aa7031da02e, 0x6e6493059195843a, 0x324ba630c18fc6e1, 0x8412693616085d7f,
+	0x3427bee7eeb6de53, 0x2eedee7e19c3fbe3, 0x9ede73dfe739ef39, 0xefc7799b93735bfe, 0xef92af8ee6c50bc3, 0x2f45913216c9cebc, 0x85e08b00480a1ea8, 0x5808819308c8068e, 0x070a8ce32d404b13, 0x502aa3e91960a971, 0x8295587dea0c31a0, 0x692cfa1460328a2f,
+	0x04f63236de829631, 0xc64ed4e31ea304e5, 0x68bec1183bf304e1, 0x197b11cb8def601f, 0x47b284f23cee711b, 0xc4e7a2f632fb5712, 0x8d46fd5088979856, 0x3a94903020123e13, 0x08fa60354a705420, 0xf8c1939d204fb2d9, 0x496cd2dd3c7edd67, 0x05820b75e69c5ca9,
+	0xacb2c6b9b2bac26e, 0xd5c90dd372a4a4a6, 0x246f91eb8240f057, 0xed9de51eb8931a72, 0xe55d3a7e03566dee, 0xe83e7060ffdb1bef, 0x2f5e11140886f1f8, 0xaebe6f7ffc7eb8ef, 0xc3cd2ed2acd6db35, 0xd64793fa57fbd77f, 0x2e107cb5ef46eaf7, 0xc49340a1ce19d4a0,
+	0xe1378de77fbec287, 0xc9de181fa6e21ab2, 0x31171cfa078fd7b5, 0x8b9e9fa1472786e8, 0x391dd67ed8a66f00, 0x37c135ae551ca030, 0x9eec229af8a076fa, 0xf41a7d037224aa20, 0xaf693523bdf4e06b, 0x1f9cd14ebf0cb8ed, 0xb937c197d4009e8d, 0x2784931b0cb0c450,
+	0x820d0484d989771b, 0x88a26c9118fa0497, 0x9ffd868992d8d1e5, 0xeff1fb7732767167, 0x4833fffbee87803a, 0x9b96e05e72ed0b22, 0x7824c2983f148fc7, 0xcf75d171c02f7cdd, 0x43facb0413280eeb, 0x05fbcfa37d66ba27, 0xcee5e0919fa64e0a, 0xc7106da54d98d25d,
+	0x80965f343ab1ce63, 0xe19e8042303292b6, 0xb5d94db461737a05, 0x59013c362e2a4e0e, 0x2a048321713a4a78, 0xb7f9663756910dc2, 0x2e2efadb63848fed, 0xf0f97ac389d4f4f1, 0x664a05dd225d06b8, 0x3e9a4dea857bfca3, 0x7ff84291906f9242, 0x79f4d8685809eae0,
+	0xb67ab82cb7a80866, 0xcac8b6a37cadc4b9, 0xef42345e190aac0d, 0x0422c963b974f883, 0x360f1c960c45c5e6, 0x84dcd63d7c2dc259, 0xa6fd5f33d6ced8c9, 0x846a7f749d6c93b2, 0xdd30524995e7e9ab, 0x8afe103a19f3512a, 0xb46f5093f1f46afb, 0x7c2a7ab22cc40678,
+	0x2cd17e36ac4d66f3, 0x3b5892155ff0b0e0, 0x4c9e50f154359868, 0x78301bdee4fe5470, 0xfa1131069ecf7a49, 0x56355f17106951f8, 0x059c99f1567c2c22, 0xc2e2eb59f72daa51, 0xaa2d71fd2a22a6d2, 0x32fc11946636c09b, 0x96387fa6bd7bf52a, 0xba36ab778bfa971e,
+	0x9d1527b640cecde0, 0x0260bf68f156f48b, 0x04bb902914acc097, 0x4ac2a72a8f5cd49a, 0xba6da23ca2df40a6, 0x7bda0ebc72a8634b, 0xe373eafa7b3cf7dd, 0xe1dc9ecce44d0f78, 0x5f7ddf0bd832f5a6, 0x73d2a800ae6de72d, 0xaa457e4b656854bf, 0x9664882255a59607,
+	0xd329ef5cdd7360eb, 0xdf1c7f7d5576828a, 0xda65f6e2422ad141, 0x76f9cd35702d9e0b, 0x6eb4f693114119d6, 0x7cc9565a99b5d5a0, 0x26f9bdbdd4623ad5, 0xd42ff000deeee027, 0x509befac629ab3b4, 0x32d586e4f3c64296, 0xe7dfaed691be5b5b, 0xb84cd50a65dd7c3b,
+	0x2c0735d7698b15f3, 0xb6c4315f82d20a9d, 0xaed252e529bffd27, 0xee3f2aff00ce9491, 0xa033ddb4ee000000, 0x0049454e44ae4260
+};
+
+#endif /* FLOWER_PNG_H */
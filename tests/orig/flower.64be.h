@@ -0,0 +1,28 @@
+#ifndef FLOWER_PNG_H
+#define FLOWER_PNG_H
+
+static const unsigned long long flower_png[] = {
+	0x0a1a0a0d474e5089, 0x524448490d000000, 0x4000000040000000, 0x81b79d0000000308, 0x544c50fd020000ec, 0x2903002500003a45, 0x03004100013c0000, 0x0145000045000044, 0x4d00004c00004b01, 0x00005401004e0000, 0x0057000250000056, 0x5a01006000005e01,
+	0x0000620200610002, 0x006b01006a000069, 0x6d00036500006c02, 0x0100740000730001, 0x0077000076020075, 0x7900007d00036e00, 0x00047a0000820002, 0x0283020089010088, 0x8d00038400008b00, 0x00009e0000930001, 0x01a30200a10100a0, 0xb70002af0200ae00,
+	0x0000b90000b80000, 0x00c30000c20000bf, 0xcd0104bb0000c500, 0x0000d00300cd0000, 0x01d20004c70600d1, 0xdb0100d90000d800, 0x0300dc0000dc0200, 0x03d20001de0d00db, 0xe90000e80000e210, 0x0d00e90b00e70100, 0x00f20000f00000ef, 0xf40700f10000f300,
+	0x0200fb0003ea0000, 0x00fc0000fd0002f6, 0xeb0000ff0000ff03, 0x0006f71401ff0408, 0x14cd0b11d7070ce1, 0xc41c12d72121a216, 0x1514d81e16ce1918, 0x1ad11616d91818cf, 0xca1d21ca1a1cd219, 0x2523cb2826ba2421, 0x24cd1f24cd2126c4, 0xff2c2bbf2928c525,
+	0x1d1dff2d27cf141b, 0x30c22d2ecb292ad2, 0xcd3636b7332fcb34, 0x393aba3234c73431, 0x39c23437ca3836c8, 0xc4383bc53b3cbd3c, 0x3c3ebf3b39cc3d3b, 0x2fff3f3dc62d2dfe, 0xc54342cb3531ff2e, 0x4644c53e42cd4144, 0x46c74544ce4446bf, 0xcb4548cb484ac348,
+	0x5451b23d3cff4b4a, 0x4fc94f50c24d4cce, 0xff5253c65451cb4c, 0x4547ff5857c14546, 0x5cb74c48ff5456c8, 0xc55658cb5a59c45c, 0x5d5acc585acd5a5a, 0x5fca4d4fff5c5fc3, 0xc86060cc5451ff5f, 0x6667c46262ce6063, 0x5aff5759ff5658ff, 0xc9696ac86a68cc5d,
+	0x6062ff5e60ff6b6c, 0x68fe7574ca6662ff, 0xcf696bff686aff67, 0x706cff797aca7978, 0x7dcd7c7bd2706ffe, 0xff7f7ed57272ff7b, 0x7477ff8082d27373, 0x78ff8785ce8183d4, 0xfd7c7aff8483db7a, 0x7e80ff8b8ad27c7e, 0x8bdd8081ff888adb, 0xdf8682ff8e8dd689,
+	0x8c8ee0908fd88b8d, 0x87ff8786fe928edf, 0xe29493dd8e90e388, 0x8b8dff9193e69592, 0x98e39390ff8c8eff, 0xfe9b9ae5999ade99, 0x9797ff9d9fe29494, 0xa1ec989bfe9f9ee9, 0xffa2a2ed9a9dffa1, 0xa5a5f0a4a4efa19e, 0xa7f3a3a3fea2a2fd, 0xf4a5a5ffa4a4ffa8,
+	0xa6a9fdaaa9f5a9a8, 0xacf8a7aaffacabf7, 0xffafaefaafacffad, 0xb1b0fdb1aeffb0ad, 0x1e28b3b3ffb2b2fe, 0x527401000000f645, 0x0066d8e64000534e, 0x0073594870090000, 0x01d70d0000d70d00, 0x07000000789b2842, 0x0c09e307454d4974, 0x000cb00203202d02,
+	0x58544144493a0400, 0x1855536c6d57edc3, 0x3f748c66a4b6629e, 0x6e8fdd6ea4c6966e, 0x5909984ba4b0b066, 0x3c7f735d25c1b443, 0x106acc647dafcc81, 0x66fc160a207e2027, 0x2ea01d03a71a9453, 0x3a8495910593646e, 0xe1c68fc130a64b32, 0x7f5d081636691284,
+	0x53deb6eee7be2734, 0xe3fbc3197eeeed2e, 0x39ef39e7df73de9e, 0xfe5b73939b79c7ef, 0xc30bc5e68eaf92ef, 0xbccec9163291452f, 0xa81e0a48008be085, 0x8e06c80893810858, 0x134b402de38c0a07, 0x71a96019e9a32a50, 0xa0310cea7d589582, 0x2f8a326014fa2c69,
+	0x319682de3632f604, 0xe504a31ee3d44ec6, 0xe104f33b18c1be68, 0x1f60ef8dcb117b19, 0x1b71ee3cf284b247, 0x1257fb32f6a2e7c4, 0x5698978850fd468d, 0x133e12203090943a, 0x2054704a3560fa08, 0xd9b24f209d93c1f8, 0x67dd7e3cddd26c49, 0xa95c9ce6750b8205,
+	0x6ec2bab2b9c6b2ac, 0xa6a4a472d30dc9d5, 0x57f04082eb916f24, 0x721a93b81ee59ded, 0xee6d56037e3a5de5, 0xef1bdbff60703ee8, 0xf8f1860814115e2f, 0xefb87efc7f6fbeae, 0x35dbd6acd22ecdc3, 0x7fd7fb57fa9347d6, 0xf7ea46efb57c102e, 0xa0d419cea14093c4,
+	0x87c2be7fe78d37e1, 0xb21ae2a61f18dec9, 0xb5d78f07fa1c1731, 0xe8862747a19f9e8b, 0x006fa6d87ed61d39, 0x30a01c55ae35c137, 0xfa76a0f89a22ec9e, 0x20aa2472037d1af4, 0x6be0f4bd233569af, 0xedb80cbf4ed19c1f, 0x8d9e00d497c137b9, 0x50c4b00c1b938427,
+	0x1b7789d984040d82, 0x9704fa18916ca288, 0xe5d1d8928986fd9f, 0x6771763277fbf1ef, 0x3a8087eefbff3348, 0x220bed725ee0969b, 0xc78f143f98c22478, 0xdd7c2fc071d175cf, 0xeb0e281304cbfa43, 0x27ba667da3cffb05, 0x0a4ea69f91e0e5ce, 0x5dd2984da56d10c7,
+	0x63ceb13a345f9680, 0xb692323042809ee1, 0x057a7361b44dd9b5, 0x0e4e2a2e363c0159, 0x784a3a712183042a, 0xc20d91563766f9b7, 0xed8f8463dbfa2e2e, 0xf1f4d489c37af9f0, 0xb8065d22dd054a66, 0xa3fc7b85ea4d9a3e, 0x42926f909142f87f, 0xe0ea095868d8f479,
+	0x6608a8b72cb87ab6, 0xb9c4ad7ca3b6c8ca, 0x0dac0a195e3442ef, 0x83f874b963c92204, 0xe6c5450c961c0f36, 0x59c22d7c3dd6dc84, 0xc9d8ced6335ffda6, 0xb2936c9d747f6a84, 0xabe9e795495230dd, 0x2a51f3193a10fe8a, 0xfb6af4f193506fb4, 0x7806c42cb27a2a7c,
+	0xf3664dac367ed12c, 0xe0b0f05f1592583b, 0x68983554f1509e4c, 0x7054fee4de1b3078, 0x497acf9e063111fa, 0xf8516910175f3556, 0x222c7c56f1999c05, 0x51aa2df759ebe2c2, 0xd2a6222afd712daa, 0x9bc036669411fc32, 0x2af57bbda67f3896, 0x1e97fa8b77ab36ba,
+	0xe0cdce40b627159d, 0x8bf456f168bf6002, 0x97c0ac142990bb04, 0x9ad45c8f2aa7c24a, 0xa640dfa23ca26dba, 0x4b63a872bc0eda7b, 0xddf73c7bfaea73e3, 0x780f4de4cc9edce1, 0xa6f532d80bdf7d5f, 0x2de76dae00a8d273, 0xbf5468654b7e45aa, 0x0796a55522886496,
+	0xeb6073dd5cef29d3, 0x8a8276557d7f1cdf, 0x41d12a42e2f665da, 0x0b9e2d7035cdf976, 0xd619411193f6b46e, 0xa0d5b5995a56c97c, 0xd53a62d4bdbdf926, 0x27e0eede00f02fd4, 0xb4b39a62acef9b50, 0x9642c6f3e486d532, 0x5b5bbe91d6aedfe7, 0x3b7cdd650ad54cb8,
+	0xf3158b69d735072c, 0x9d0ad2825f31c4b6, 0x27fdbf29e552d2ae, 0x9194ce00ff2a3fee, 0x000000eeb4dd33a0, 0x6042ae444e454900
+};
+
+#endif /* FLOWER_PNG_H */
@@ -0,0 +1,18 @@
+#ifndef FLOWER_PNG_H
+#define FLOWER_PNG_H
+
+#ifdef __has_embed
+#if __has_embed("../flower.png")
+#define FLOWER_PNG_EMBED 1
+#endif
+#endif
+
+static const unsigned char flower_png[] = {
+#ifndef FLOWER_PNG_EMBED
+#error "#embed is not supported by this compiler"
+#else
+#embed "../flower.png"
+#endif
+};
+
+#endif /* FLOWER_PNG_H */
@@ -0,0 +1,14 @@
+#ifndef FLOWER_PNG_H
+#define FLOWER_PNG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern const unsigned char flower_png[1969];
+extern const unsigned char flower_png_end[];
+extern const unsigned long long flower_png_size;
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLOWER_PNG_H */
@@ -0,0 +1,51 @@
+#ifndef FLOWER_INDEX_H
+#define FLOWER_INDEX_H
+
+#include <string.h>
+
+#include "batch/flower.png.h"
+#include "batch/flower2.png.h"
+
+#if defined(__cplusplus) && __cplusplus >= 201402L
+#define FLOWER_INDEX_CONST constexpr
+#else
+#define FLOWER_INDEX_CONST const
+#endif
+
+typedef struct flower_index_entry {
+	const char* name;
+	const unsigned char* data;
+	unsigned long long size;
+} flower_index_entry;
+
+/* seeds of a minimal perfect hash, each name has a slot of its own */
+static FLOWER_INDEX_CONST unsigned long flower_index_seeds[2] = {
+	1UL, 1UL
+};
+
+static FLOWER_INDEX_CONST flower_index_entry flower_index_entries[2] = {
+	{ "flower_png", flower_png, 1969 },
+	{ "flower2_png", flower2_png, 1969 }
+};
+
+static inline unsigned long flower_index_hash(const char* name, const unsigned long seed) {
+	unsigned long hash = (2166136261UL ^ (seed * 2654435769UL)) & 0xffffffffUL;
+	for (; *name != '\0'; name++) {
+		hash = ((hash ^ (unsigned char) *name) * 16777619UL) & 0xffffffffUL;
+	}
+	hash ^= hash >> 16;
+	hash = (hash * 2246822507UL) & 0xffffffffUL;
+	hash ^= hash >> 13;
+	hash = (hash * 3266489909UL) & 0xffffffffUL;
+	return hash ^ (hash >> 16);
+}
+
+/* finds data by its name without searching, NULL if not found */
+static inline const unsigned char* flower_index_find(const char* name, unsigned long long* size) {
+	const flower_index_entry* entry = &flower_index_entries[flower_index_hash(name, flower_index_seeds[flower_index_hash(name, 0) % 2]) % 2];
+	if (strcmp(name, entry->name) != 0) return NULL;
+	if (size != NULL) *size = entry->size;
+	return entry->data;
+}
+
+#endif /* FLOWER_INDEX_H */
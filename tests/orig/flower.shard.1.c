@@ -0,0 +1,83 @@
+#include "flower.shard.h"
+
+const unsigned char flower_png_1[] = {
+	0x07, 0x0a, 0x8c, 0xe3, 0x2d, 0x40, 0x4b, 0x13, 0x50, 0x2a, 0xa3, 0xe9,
+	0x19, 0x60, 0xa9, 0x71, 0x82, 0x95, 0x58, 0x7d, 0xea, 0x0c, 0x31, 0xa0,
+	0x69, 0x2c, 0xfa, 0x14, 0x60, 0x32, 0x8a, 0x2f, 0x04, 0xf6, 0x32, 0x36,
+	0xde, 0x82, 0x96, 0x31, 0xc6, 0x4e, 0xd4, 0xe3, 0x1e, 0xa3, 0x04, 0xe5,
+	0x68, 0xbe, 0xc1, 0x18, 0x3b, 0xf3, 0x04, 0xe1, 0x19, 0x7b, 0x11, 0xcb,
+	0x8d, 0xef, 0x60, 0x1f, 0x47, 0xb2, 0x84, 0xf2, 0x3c, 0xee, 0x71, 0x1b,
+	0xc4, 0xe7, 0xa2, 0xf6, 0x32, 0xfb, 0x57, 0x12, 0x8d, 0x46, 0xfd, 0x50,
+	0x88, 0x97, 0x98, 0x56, 0x3a, 0x94, 0x90, 0x30, 0x20, 0x12, 0x3e, 0x13,
+	0x08, 0xfa, 0x60, 0x35, 0x4a, 0x70, 0x54, 0x20, 0xf8, 0xc1, 0x93, 0x9d,
+	0x20, 0x4f, 0xb2, 0xd9, 0x49, 0x6c, 0xd2, 0xdd, 0x3c, 0x7e, 0xdd, 0x67,
+	0x05, 0x82, 0x0b, 0x75, 0xe6, 0x9c, 0x5c, 0xa9, 0xac, 0xb2, 0xc6, 0xb9,
+	0xb2, 0xba, 0xc2, 0x6e, 0xd5, 0xc9, 0x0d, 0xd3, 0x72, 0xa4, 0xa4, 0xa6,
+	0x24, 0x6f, 0x91, 0xeb, 0x82, 0x40, 0xf0, 0x57, 0xed, 0x9d, 0xe5, 0x1e,
+	0xb8, 0x93, 0x1a, 0x72, 0xe5, 0x5d, 0x3a, 0x7e, 0x03, 0x56, 0x6d, 0xee,
+	0xe8, 0x3e, 0x70, 0x60, 0xff, 0xdb, 0x1b, 0xef, 0x2f, 0x5e, 0x11, 0x14,
+	0x08, 0x86, 0xf1, 0xf8, 0xae, 0xbe, 0x6f, 0x7f, 0xfc, 0x7e, 0xb8, 0xef,
+	0xc3, 0xcd, 0x2e, 0xd2, 0xac, 0xd6, 0xdb, 0x35, 0xd6, 0x47, 0x93, 0xfa,
+	0x57, 0xfb, 0xd7, 0x7f, 0x2e, 0x10, 0x7c, 0xb5, 0xef, 0x46, 0xea, 0xf7,
+	0xc4, 0x93, 0x40, 0xa1, 0xce, 0x19, 0xd4, 0xa0, 0xe1, 0x37, 0x8d, 0xe7,
+	0x7f, 0xbe, 0xc2, 0x87, 0xc9, 0xde, 0x18, 0x1f, 0xa6, 0xe2, 0x1a, 0xb2,
+	0x31, 0x17, 0x1c, 0xfa, 0x07, 0x8f, 0xd7, 0xb5, 0x8b, 0x9e, 0x9f, 0xa1,
+	0x47, 0x27, 0x86, 0xe8, 0x39, 0x1d, 0xd6, 0x7e, 0xd8, 0xa6, 0x6f, 0x00,
+	0x37, 0xc1, 0x35, 0xae, 0x55, 0x1c, 0xa0, 0x30, 0x9e, 0xec, 0x22, 0x9a,
+	0xf8, 0xa0, 0x76, 0xfa, 0xf4, 0x1a, 0x7d, 0x03, 0x72, 0x24, 0xaa, 0x20,
+	0xaf, 0x69, 0x35, 0x23, 0xbd, 0xf4, 0xe0, 0x6b, 0x1f, 0x9c, 0xd1, 0x4e,
+	0xbf, 0x0c, 0xb8, 0xed, 0xb9, 0x37, 0xc1, 0x97, 0xd4, 0x00, 0x9e, 0x8d,
+	0x27, 0x84, 0x93, 0x1b, 0x0c, 0xb0, 0xc4, 0x50, 0x82, 0x0d, 0x04, 0x84,
+	0xd9, 0x89, 0x77, 0x1b, 0x88, 0xa2, 0x6c, 0x91, 0x18, 0xfa, 0x04, 0x97,
+	0x9f, 0xfd, 0x86, 0x89, 0x92, 0xd8, 0xd1, 0xe5, 0xef, 0xf1, 0xfb, 0x77,
+	0x32, 0x76, 0x71, 0x67, 0x48, 0x33, 0xff, 0xfb, 0xee, 0x87, 0x80, 0x3a,
+	0x9b, 0x96, 0xe0, 0x5e, 0x72, 0xed, 0x0b, 0x22, 0x78, 0x24, 0xc2, 0x98,
+	0x3f, 0x14, 0x8f, 0xc7, 0xcf, 0x75, 0xd1, 0x71, 0xc0, 0x2f, 0x7c, 0xdd,
+	0x43, 0xfa, 0xcb, 0x04, 0x13, 0x28, 0x0e, 0xeb, 0x05, 0xfb, 0xcf, 0xa3,
+	0x7d, 0x66, 0xba, 0x27, 0xce, 0xe5, 0xe0, 0x91, 0x9f, 0xa6, 0x4e, 0x0a,
+	0xc7, 0x10, 0x6d, 0xa5, 0x4d, 0x98, 0xd2, 0x5d, 0x80, 0x96, 0x5f, 0x34,
+	0x3a, 0xb1, 0xce, 0x63, 0xe1, 0x9e, 0x80, 0x42, 0x30, 0x32, 0x92, 0xb6,
+	0xb5, 0xd9, 0x4d, 0xb4, 0x61, 0x73, 0x7a, 0x05, 0x59, 0x01, 0x3c, 0x36,
+	0x2e, 0x2a, 0x4e, 0x0e, 0x2a, 0x04, 0x83, 0x21, 0x71, 0x3a, 0x4a, 0x78,
+	0xb7, 0xf9, 0x66, 0x37, 0x56, 0x91, 0x0d, 0xc2, 0x2e, 0x2e, 0xfa, 0xdb,
+	0x63, 0x84, 0x8f, 0xed, 0xf0, 0xf9, 0x7a, 0xc3, 0x89, 0xd4, 0xf4, 0xf1,
+	0x66, 0x4a, 0x05, 0xdd, 0x22, 0x5d, 0x06, 0xb8, 0x3e, 0x9a, 0x4d, 0xea,
+	0x85, 0x7b, 0xfc, 0xa3, 0x7f, 0xf8, 0x42, 0x91, 0x90, 0x6f, 0x92, 0x42,
+	0x79, 0xf4, 0xd8, 0x68, 0x58, 0x09, 0xea, 0xe0, 0xb6, 0x7a, 0xb8, 0x2c,
+	0xb7, 0xa8, 0x08, 0x66, 0xca, 0xc8, 0xb6, 0xa3, 0x7c, 0xad, 0xc4, 0xb9,
+	0xef, 0x42, 0x34, 0x5e, 0x19, 0x0a, 0xac, 0x0d, 0x04, 0x22, 0xc9, 0x63,
+	0xb9, 0x74, 0xf8, 0x83, 0x36, 0x0f, 0x1c, 0x96, 0x0c, 0x45, 0xc5, 0xe6,
+	0x84, 0xdc, 0xd6, 0x3d, 0x7c, 0x2d, 0xc2, 0x59, 0xa6, 0xfd, 0x5f, 0x33,
+	0xd6, 0xce, 0xd8, 0xc9, 0x84, 0x6a, 0x7f, 0x74, 0x9d, 0x6c, 0x93, 0xb2,
+	0xdd, 0x30, 0x52, 0x49, 0x95, 0xe7, 0xe9, 0xab, 0x8a, 0xfe, 0x10, 0x3a,
+	0x19, 0xf3, 0x51, 0x2a, 0xb4, 0x6f, 0x50, 0x93, 0xf1, 0xf4, 0x6a, 0xfb,
+	0x7c, 0x2a, 0x7a, 0xb2, 0x2c, 0xc4, 0x06, 0x78, 0x2c, 0xd1, 0x7e, 0x36,
+	0xac, 0x4d, 0x66, 0xf3, 0x3b, 0x58, 0x92, 0x15, 0x5f, 0xf0, 0xb0, 0xe0,
+	0x4c, 0x9e, 0x50, 0xf1, 0x54, 0x35, 0x98, 0x68, 0x78, 0x30, 0x1b, 0xde,
+	0xe4, 0xfe, 0x54, 0x70, 0xfa, 0x11, 0x31, 0x06, 0x9e, 0xcf, 0x7a, 0x49,
+	0x56, 0x35, 0x5f, 0x17, 0x10, 0x69, 0x51, 0xf8, 0x05, 0x9c, 0x99, 0xf1,
+	0x56, 0x7c, 0x2c, 0x22, 0xc2, 0xe2, 0xeb, 0x59, 0xf7, 0x2d, 0xaa, 0x51,
+	0xaa, 0x2d, 0x71, 0xfd, 0x2a, 0x22, 0xa6, 0xd2, 0x32, 0xfc, 0x11, 0x94,
+	0x66, 0x36, 0xc0, 0x9b, 0x96, 0x38, 0x7f, 0xa6, 0xbd, 0x7b, 0xf5, 0x2a,
+	0xba, 0x36, 0xab, 0x77, 0x8b, 0xfa, 0x97, 0x1e, 0x9d, 0x15, 0x27, 0xb6,
+	0x40, 0xce, 0xcd, 0xe0, 0x02, 0x60, 0xbf, 0x68, 0xf1, 0x56, 0xf4, 0x8b,
+	0x04, 0xbb, 0x90, 0x29, 0x14, 0xac, 0xc0, 0x97, 0x4a, 0xc2, 0xa7, 0x2a,
+	0x8f, 0x5c, 0xd4, 0x9a, 0xba, 0x6d, 0xa2, 0x3c, 0xa2, 0xdf, 0x40, 0xa6,
+	0x7b, 0xda, 0x0e, 0xbc, 0x72, 0xa8, 0x63, 0x4b, 0xe3, 0x73, 0xea, 0xfa,
+	0x7b, 0x3c, 0xf7, 0xdd, 0xe1, 0xdc, 0x9e, 0xcc, 0xe4, 0x4d, 0x0f, 0x78,
+	0x5f, 0x7d, 0xdf, 0x0b, 0xd8, 0x32, 0xf5, 0xa6, 0x73, 0xd2, 0xa8, 0x00,
+	0xae, 0x6d, 0xe7, 0x2d, 0xaa, 0x45, 0x7e, 0x4b, 0x65, 0x68, 0x54, 0xbf,
+	0x96, 0x64, 0x88, 0x22, 0x55, 0xa5, 0x96, 0x07, 0xd3, 0x29, 0xef, 0x5c,
+	0xdd, 0x73, 0x60, 0xeb, 0xdf, 0x1c, 0x7f, 0x7d, 0x55, 0x76, 0x82, 0x8a,
+	0xda, 0x65, 0xf6, 0xe2, 0x42, 0x2a, 0xd1, 0x41, 0x76, 0xf9, 0xcd, 0x35,
+	0x70, 0x2d, 0x9e, 0x0b, 0x6e, 0xb4, 0xf6, 0x93, 0x11, 0x41, 0x19, 0xd6,
+	0x7c, 0xc9, 0x56, 0x5a, 0x99, 0xb5, 0xd5, 0xa0, 0x26, 0xf9, 0xbd, 0xbd,
+	0xd4, 0x62, 0x3a, 0xd5, 0xd4, 0x2f, 0xf0, 0x00, 0xde, 0xee, 0xe0, 0x27,
+	0x50, 0x9b, 0xef, 0xac, 0x62, 0x9a, 0xb3, 0xb4, 0x32, 0xd5, 0x86, 0xe4,
+	0xf3, 0xc6, 0x42, 0x96, 0xe7, 0xdf, 0xae, 0xd6, 0x91, 0xbe, 0x5b, 0x5b,
+	0xb8, 0x4c, 0xd5, 0x0a, 0x65, 0xdd, 0x7c, 0x3b, 0x2c, 0x07, 0x35, 0xd7,
+	0x69, 0x8b, 0x15, 0xf3, 0xb6, 0xc4, 0x31, 0x5f, 0x82, 0xd2, 0x0a, 0x9d,
+	0xae, 0xd2, 0x52, 0xe5, 0x29, 0xbf, 0xfd, 0x27, 0xee, 0x3f, 0x2a, 0xff,
+	0x00, 0xce, 0x94, 0x91, 0xa0, 0x33, 0xdd, 0xb4, 0xee, 0x00, 0x00, 0x00,
+	0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+};
@@ -0,0 +1,8 @@
+#include "flower.shard.h"
+
+const unsigned char* const flower_png_shards[2] = {
+	flower_png_0,
+	flower_png_1
+};
+
+const unsigned long long flower_png_size = 1969;
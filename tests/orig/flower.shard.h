@@ -0,0 +1,34 @@
+#ifndef FLOWER_PNG_H
+#define FLOWER_PNG_H
+
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern const unsigned char flower_png_0[];
+extern const unsigned char flower_png_1[];
+extern const unsigned char* const flower_png_shards[2];
+extern const unsigned long long flower_png_size;
+#ifdef __cplusplus
+}
+#endif
+
+/* shards of 1024 bytes accessed as one buffer */
+static inline unsigned char flower_png_at(const unsigned long long pos) {
+	return flower_png_shards[pos / 1024][pos % 1024];
+}
+
+static inline void flower_png_copy(void* dest, unsigned long long pos, unsigned long long count) {
+	unsigned char* out = (unsigned char*) dest;
+	while (count > 0) {
+		unsigned long long part = 1024 - pos % 1024;
+		if (part > count) part = count;
+		memcpy(out, flower_png_shards[pos / 1024] + pos % 1024, (size_t) part);
+		out += part;
+		pos += part;
+		count -= part;
+	}
+}
+
+#endif /* FLOWER_PNG_H */
@@ -0,0 +1,178 @@
+#ifndef FLOWER_PNG_H
+#define FLOWER_PNG_H
+
+#ifdef __cplusplus
+static const unsigned char flower_png[1969 + 1] =
+#else
+static const unsigned char flower_png[1969] =
+#endif
+	"\211PNG\r\n\32\n\0\0\0\r"
+	"IHDR\0\0\0@\0\0\0@"
+	"\10\3\0\0\0\235\267\201\354\0\0\2"
+	"\375PLTE:\0\0%\0\3)"
+	"\0\0<\1\0A\0\3D\0\0E"
+	"\0\0E\1\1K\0\0L\0\0M"
+	"\0\0N\0\1T\0\0V\0\0P"
+	"\2\0W\0\1^\0\0`\0\1Z"
+	"\2\0a\0\2b\0\0i\0\0j"
+	"\0\1k\0\2l\0\0e\3\0m"
+	"\1\0s\0\0t\0\1u\0\2v"
+	"\0\0w\0\0n\3\0}\0\0y"
+	"\2\0\202\0\0z\4\0\210\0\1\211"
+	"\0\2\203\2\0\213\0\0\204\3\0\215"
+	"\1\0\223\0\0\236\0\0\240\0\1\241"
+	"\0\2\243\1\0\256\0\2\257\2\0\267"
+	"\0\0\270\0\0\271\0\0\277\0\0\302"
+	"\0\0\303\0\0\305\0\0\273\4\1\315"
+	"\0\0\315\0\3\320\0\0\321\0\6\307"
+	"\4\0\322\1\0\330\0\0\331\0\1\333"
+	"\0\2\334\0\0\334\0\3\333\0\r\336"
+	"\1\0\322\3\20\342\0\0\350\0\0\351"
+	"\0\1\347\0\13\351\0\r\357\0\0\360"
+	"\0\0\362\0\0\363\0\0\361\0\7\364"
+	"\0\0\352\3\0\373\0\2\366\2\0\375"
+	"\0\0\374\0\3\377\0\0\377\0\0\353"
+	"\10\4\377\1\24\367\6\0\341\14\7\327"
+	"\21\13\315\24\26\242!!\327\22\34\304"
+	"\30\31\316\26\36\330\24\25\317\30\30\331"
+	"\26\26\321\32\31\322\34\32\312!\35\312"
+	"!$\272&(\313#%\304&!\315"
+	"$\37\315$%\305()\277+,\377"
+	"\33\24\317'-\377\35\35\322*)\313"
+	".-\30204\313/3\26766\315"
+	"14\30742\272:9\31068\312"
+	"74\3029<\275<;\305;8\304"
+	";=\3149;\277><\376--\306"
+	"=?\377/.\37715\313BC\305"
+	"DA\315B>\305DF\277FD\316"
+	"DE\307FH\303JH\313HE\313"
+	"JK\377<=\262QT\316LM\302"
+	"PO\311OL\313QT\306SR\377"
+	"FE\301WX\377GE\310VT\377"
+	"HL\267\\\\\304YZ\313XV\305"
+	"ZZ\315ZX\314Z]\303_\\\377"
+	"OM\312__\377QT\314``\310"
+	"c`\316bb\304gf\377XV\377"
+	"YW\377Z]\314hj\310ji\311"
+	"lk\377`^\377b`\377bf\312"
+	"tu\376hg\377jh\377ki\317"
+	"xy\312zy\377lp\376op\322"
+	"{|\315}{\377rr\325~\177\377"
+	"ss\322\202\200\377wt\324\203\201\316"
+	"\205\207\377xz\333\203\204\377z|\375"
+	"~|\322\212\213\377\200~\333\212\210\377"
+	"\201\200\335\213\211\326\215\216\377\202\206\337"
+	"\215\213\330\217\220\340\216\214\337\216\222\376"
+	"\206\207\377\207\210\343\220\216\335\223\224\342"
+	"\222\225\346\223\221\377\215\213\377\216\214\377"
+	"\220\223\343\230\231\336\232\231\345\232\233\376"
+	"\224\224\342\237\235\377\227\227\351\236\237\376"
+	"\233\230\354\241\241\377\235\232\355\242\242\377"
+	"\236\241\357\244\244\360\245\245\375\242\242\376"
+	"\243\243\363\247\250\377\244\244\377\245\245\364"
+	"\250\251\365\251\252\375\251\246\367\253\254\377"
+	"\252\247\370\254\255\377\254\257\372\256\257\377"
+	"\255\260\377\256\261\375\260\261\376\262\262\377"
+	"\263\263(\36E\366\0\0\0\1tR"
+	"NS\0@\346\330f\0\0\0\tp"
+	"HYs\0\0\r\327\0\0\r\327\1"
+	"B(\233x\0\0\0\7tIME"
+	"\7\343\t\14\2- \3\2\260\14\0"
+	"\0\4:IDATX\303\355Wm"
+	"lSU\30\236b\266\244f\214t?"
+	"n\226\306\244n\335\217nf\260\260\244"
+	"K\230\tYC\264\301%]s\177<"
+	"\201\314\257}d\314j\20' ~ "
+	"\n\26\374fS\224\32\247\3\35\240."
+	"nd\223\5\221\225\204:2K\2460"
+	"\301\217\306\341\204\22i6\26\10]\177"
+	"4'\276\347\356\266\336S.\355\356~"
+	"\31\303\373\343\236\336s\337\3479\3579"
+	"\357\307y\233\223s[\376\357\222\257\216"
+	"\346\305\13\303/E\2212\26\311\316\274"
+	"\205\340\213\0H\n\36\250X\10\201\223"
+	"\10\310\6\216\7\n\214\343-@K\23"
+	"P*\243\351\31`\251q\202\225X}"
+	"\352\0141\240i,\372\24`2\212/"
+	"\4\36626\336\202\2261\306N\324\343"
+	"\36\243\4\345h\276\301\30;\363\4\341"
+	"\31{\21\313\215\357`\37G\262\204\362"
+	"<\356q\33\304\347\242\3662\373W\22"
+	"\215F\375P\210\227\230V:\224\2200"
+	" \22>\23\10\372`5JpT "
+	"\370\301\223\235 O\262\331Il\322\335"
+	"<~\335g\5\202\13u\346\234\\\251"
+	"\254\262\306\271\262\272\302n\325\311\r\323"
+	"r\244\244\246$o\221\353\202@\360W"
+	"\355\235\345\36\270\223\32r\345]:~"
+	"\3Vm\356\350>p`\377\333\33\357"
+	"/^\21\24\10\206\361\370\256\276o\177"
+	"\374~\270\357\303\315.\322\254\326\3335"
+	"\326G\223\372W\373\327\177.\20|\265"
+	"\357F\352\367\304\223@\241\316\31\324\240"
+	"\3417\215\347\177\276\302\207\311\336\30\37"
+	"\246\342\32\2621\27\34\372\7\217\327\265"
+	"\213\236\237\241G'\206\3509\35\326~"
+	"\330\246o\0007\3015\256U\34\2400"
+	"\236\354\"\232\370\240v\372\364\32}\3"
+	"r$\252 \257i5#\275\364\340k"
+	"\37\234\321N\277\14\270\355\2717\301\227"
+	"\324\0\236\215'\204\223\33\14\260\304P"
+	"\202\r\4\204\331\211w\33\210\242l\221"
+	"\30\372\4\227\237\375\206\211\222\330\321\345"
+	"\357\361\373w2vqgH3\377\373"
+	"\356\207\200:\233\226\340^r\355\13\""
+	"x$\302\230?\24\217\307\317u\321q"
+	"\300/|\335C\372\313\4\23(\16\353"
+	"\5\373\317\243}f\272'\316\345\340\221"
+	"\237\246N\n\307\20m\245M\230\322]"
+	"\200\226_4:\261\316c\341\236\200B"
+	"02\222\266\265\331M\264asz\5"
+	"Y\1<6.*N\16*\4\203!"
+	"q:Jx\267\371f7V\221\r\302"
+	"..\372\333c\204\217\355\360\371z\303"
+	"\211\324\364\361fJ\5\335\"]\6\270"
+	">\232M\352\205{\374\243\177\370B\221"
+	"\220o\222By\364\330hX\t\352\340"
+	"\266z\270,\267\250\10f\312\310\266\243"
+	"|\255\304\271\357B4^\31\n\254\r"
+	"\4\"\311c\271t\370\2036\17\34\226"
+	"\14E\305\346\204\334\326=|-\302Y"
+	"\246\375_3\326\316\330\311\204j\177t"
+	"\235l\223\262\3350RI\225\347\351\253"
+	"\212\376\20:\31\363Q*\264oP\223"
+	"\361\364j\373|*z\262,\304\6x"
+	",\321~6\254Mf\363;X\222\25"
+	"_\360\260\340L\236P\361T5\230h"
+	"x0\33\336\344\376Tp\372\0211\6"
+	"\236\317zIV5_\27\20iQ\370"
+	"\5\234\231\361V|,\"\302\342\353Y"
+	"\367-\252Q\252-q\375*\"\246\322"
+	"2\374\21\224f6\300\233\2268\177\246"
+	"\275{\365*\2726\253w\213\372\227\36"
+	"\235\25'\266@\316\315\340\2`\277h"
+	"\361V\364\213\4\273\220)\24\254\300\227"
+	"J\302\247*\217\\\324\232\272m\242<"
+	"\242\337@\246{\332\16\274r\250cK"
+	"\343s\352\372{<\367\335\341\334\236\314"
+	"\344M\17x_}\337\13\3302\365\246"
+	"s\322\250\0\256m\347-\252E~K"
+	"ehT\277\226d\210\"U\245\226\7"
+	"\323)\357\\\335s`\353\337\34\177}"
+	"Uv\202\212\332e\366\342B*\321A"
+	"v\371\3155p-\236\13n\264\366\223"
+	"\21A\31\326|\311VZ\231\265\325\240"
+	"&\371\275\275\324b:\325\324/\360\0"
+	"\336\356\340'P\233\357\254b\232\263\264"
+	"2\325\206\344\363\306B\226\347\337\256\326"
+	"\221\276[[\270L\325\ne\335|;"
+	",\0075\327i\213\25\363\266\3041_"
+	"\202\322\n\235\256\322R\345)\277\375'"
+	"\356?*\377\0\316\224\221\2403\335\264"
+	"\356\0\0\0\0IEND\256B`"
+	"\202"
+;
+
+static const unsigned long long flower_png_size = 1969;
+
+#endif /* FLOWER_PNG_H */
@@ -174,7 +174,7 @@ static const unsigned char flower_png[] = {
 };
 
 #ifdef __cplusplus
-static const std::vector<char> flower_png_v(flower_png, flower_png + sizeof(flower_png));
+static const std::vector<unsigned char> flower_png_v(flower_png, flower_png + sizeof(flower_png));
 #endif
 
 #endif /* FLOWER_PNG_H */
@@ -0,0 +1,10 @@
+#ifndef STARS_BIN_H
+#define STARS_BIN_H
+
+static const unsigned char stars_bin[] = {
+	0x61, 0x2a, 0x2f, 0x62, /* a*.b */
+	0x2a, 0x2a, 0x2f, 0x63, /* **.c */
+	0x2a, 0x2f, 0x2a, 0x2f                          /* *.*. */
+};
+
+#endif /* STARS_BIN_H */